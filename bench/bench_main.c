@@ -0,0 +1,1812 @@
+/**
+ * @file bench_main.c
+ * @author Mickle Isaev (mrraptor26@gmail.com)
+ *
+ * @brief Замеры производительности библиотеки RMP.
+ *
+ * @copyright Copyright (c) 2024 StilSoft
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "radio_message_parser.h"
+#include "radio_message_parser_ring.h"
+#include "rmp_channel_sim.h"
+
+#define benchSCAN_MEM_SIZE    (1024u * 1024u)
+#define benchSCAN_REPEAT_NUMB (64u)
+#define benchRING_SIZE        (64u * 1024u)
+
+#define benchRESYNC_FRAMES_NUMB (100000u)
+#define benchRESYNC_CHUNK_SIZE  (256u)
+
+#define benchINGEST_DMA_BLOCK_SIZE (64u)
+#define benchINGEST_REPEAT_NUMB    (16u)
+
+#define benchMIRROR_REPEAT_NUMB (8u)
+
+#define benchMATRIX_FRAMES_NUMB (100000u)
+
+#define benchCHANNEL_FRAMES_NUMB (200000u)
+
+#define benchFAST_PATH_FRAMES_NUMB (100000u)
+#define benchFAST_PATH_REPEAT_NUMB (8u)
+
+#define benchINSTANCES_NUMB        (16384u)
+#define benchINSTANCES_RING_SIZE   (128u)
+#define benchINSTANCES_ROUNDS_NUMB (32u)
+
+#define benchTHREADS_FRAMES_NUMB (200000u)
+#define benchTHREADS_RING_SIZE   (4096u)
+
+#define benchRING_FRAMES_NUMB (100000u)
+#define benchRING_REPEAT_NUMB (8u)
+#define benchRING_CHUNK_SIZE  (64u)
+
+#define benchNOTIFY_FRAMES_NUMB (5000u)
+#define benchNOTIFY_PERIOD_NS   (100000u)
+#define benchNOTIFY_TIMEOUT_MS  (10u)
+
+/**
+ * @brief Версия библиотеки для JSON отчета (задается CMakeLists.txt).
+ */
+#ifndef benchRMP_VERSION
+    #define benchRMP_VERSION "unknown"
+#endif
+
+/**
+ * @brief Реализация конечного автомата, выбранная при сборке библиотеки
+ * (RMP_STATE_ENGINE). Результаты реализаций сравниваются между сборками.
+ */
+#if (rmpSTATE_ENGINE == rmpSTATE_ENGINE_SWITCH)
+    #define benchSTATE_ENGINE_NAME "switch"
+#else
+    #define benchSTATE_ENGINE_NAME "table"
+#endif
+
+/**
+ * @brief Реализация кольцевого буфера, выбранная при сборке библиотеки
+ * (RMP_RING_BACKEND).
+ */
+#if (rmpRING_BACKEND == rmpRING_BACKEND_SPSC)
+    #define benchRING_BACKEND_NAME "spsc"
+#elif (rmpRING_BACKEND == rmpRING_BACKEND_POW2)
+    #define benchRING_BACKEND_NAME "pow2"
+#else
+    #define benchRING_BACKEND_NAME "lwrb"
+#endif
+
+typedef enum
+{
+    benchDATA_RANDOM = 0,
+    benchDATA_FIRST_BYTE_DENSE,
+} bench_data_e;
+
+static const char *
+prvGetDataName(bench_data_e eData);
+
+static uint64_t
+prvGetTimeNs(void);
+
+static uint32_t
+prvRand(uint32_t *puSeed);
+
+static void
+prvFillData(uint8_t *pMem, size_t uLen, bench_data_e eData);
+
+static size_t
+prvFindSyncWordByMemchr(const uint8_t *pMem, size_t uLen);
+
+static void
+prvBenchScanKernel(bench_data_e eData);
+
+static void
+prvBenchScanProcessing(bench_data_e eData);
+
+static void
+prvBenchResync(void);
+
+static void
+prvBenchIngest(void);
+
+static void
+prvBenchMirror(void);
+
+static size_t
+prvMakeMatrixStream(
+    uint8_t *pMem,
+    size_t   uFramesNumb,
+    double   dNoiseRatio,
+    double   dCrcFailRate,
+    size_t  *puValidFramesNumb);
+
+static uint64_t
+prvBenchMatrixCase(
+    uint8_t *pMem,
+    size_t   uLen,
+    size_t   uRingSize,
+    size_t   uChunkSize,
+    size_t  *puFramesNumb);
+
+static void
+prvBenchMatrix(FILE *pJson);
+
+static void
+prvBenchChannel(void);
+
+static void
+prvBenchFastPath(void);
+
+static void
+prvBenchInstances(void);
+
+static void
+prvBenchThreads(void);
+
+static void
+prvBenchRing(void);
+
+static void
+prvBenchNotify(void);
+
+/**
+ * @brief Аргументы командной строки:
+ *
+ *      --json <file>   записать результаты матрицы замеров Put() и
+ *                      Processing() в <file> в формате JSON;
+ *
+ *      --matrix-only   выполнить только матрицу замеров.
+ */
+int
+main(int argc, char *argv[])
+{
+    const char *pJsonPath     = NULL;
+    bool        bIsMatrixOnly = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--json") == 0) && ((i + 1) < argc)) {
+            pJsonPath = argv[++i];
+        } else if (strcmp(argv[i], "--matrix-only") == 0) {
+            bIsMatrixOnly = true;
+        } else {
+            fprintf(
+                stderr,
+                "usage: %s [--json <file>] [--matrix-only]\n",
+                argv[0]);
+            return (EXIT_FAILURE);
+        }
+    }
+
+    printf("state_engine    %s\n", benchSTATE_ENGINE_NAME);
+    printf("ring_backend    %s\n", benchRING_BACKEND_NAME);
+
+    if (!bIsMatrixOnly) {
+        for (bench_data_e eData = benchDATA_RANDOM;
+             eData <= benchDATA_FIRST_BYTE_DENSE;
+             ++eData) {
+            prvBenchScanKernel(eData);
+            prvBenchScanProcessing(eData);
+        }
+
+        prvBenchResync();
+        prvBenchIngest();
+        prvBenchMirror();
+        prvBenchChannel();
+        prvBenchFastPath();
+        prvBenchInstances();
+        prvBenchThreads();
+        prvBenchRing();
+        prvBenchNotify();
+    }
+
+    FILE *pJson = NULL;
+    if (pJsonPath != NULL) {
+        pJson = fopen(pJsonPath, "w");
+        if (pJson == NULL) {
+            perror(pJsonPath);
+            return (EXIT_FAILURE);
+        }
+    }
+
+    prvBenchMatrix(pJson);
+
+    if (pJson != NULL) {
+        fclose(pJson);
+    }
+
+    return (EXIT_SUCCESS);
+}
+
+static const char *
+prvGetDataName(bench_data_e eData)
+{
+    return ((eData == benchDATA_RANDOM) ? "random" : "first_byte_dense");
+}
+
+static uint64_t
+prvGetTimeNs(void)
+{
+    struct timespec xTime;
+    clock_gettime(CLOCK_MONOTONIC, &xTime);
+
+    return ((uint64_t) xTime.tv_sec * 1000000000u + (uint64_t) xTime.tv_nsec);
+}
+
+static uint32_t
+prvRand(uint32_t *puSeed)
+{
+    /* xorshift32 */
+    uint32_t uX = *puSeed;
+    uX ^= uX << 13u;
+    uX ^= uX >> 17u;
+    uX ^= uX << 5u;
+    *puSeed = uX;
+
+    return (uX);
+}
+
+static void
+prvFillData(uint8_t *pMem, size_t uLen, bench_data_e eData)
+{
+    uint32_t uSeed = 0x12345678u;
+
+    for (size_t i = 0u; i < uLen; ++i) {
+        uint8_t uByte = (uint8_t) prvRand(&uSeed);
+
+        /* Неблагоприятный случай: три четверти потока составляют первые байты
+         * пары, второй байт пары не встречается */
+        if (eData == benchDATA_FIRST_BYTE_DENSE) {
+            uByte = ((uByte & 0x03u) != 0u) ? rmpSTART_FRAME_FIRST_BYTE : 0x00;
+        }
+
+        pMem[i] = uByte;
+    }
+}
+
+/**
+ * @brief Поиск пары байт по первому байту (как выполнялся поиск до появления
+ * RMP_FindSyncWord()), используется для сравнения.
+ */
+static size_t
+prvFindSyncWordByMemchr(const uint8_t *pMem, size_t uLen)
+{
+    size_t uIdx = 0u;
+
+    while ((uLen - uIdx) >= 2u) {
+        const uint8_t *pFirstByte =
+            memchr(&pMem[uIdx], rmpSTART_FRAME_FIRST_BYTE, uLen - uIdx - 1u);
+
+        if (pFirstByte == NULL) {
+            break;
+        }
+
+        uIdx = (size_t) (pFirstByte - pMem);
+
+        if (pMem[uIdx + 1u] == rmpSTART_FRAME_SECOND_BYTE) {
+            return (uIdx);
+        }
+
+        uIdx++;
+    }
+
+    return (uLen);
+}
+
+static void
+prvBenchScanKernel(bench_data_e eData)
+{
+    uint8_t *pMem = malloc(benchSCAN_MEM_SIZE);
+    prvFillData(pMem, benchSCAN_MEM_SIZE, eData);
+
+    for (size_t uKernel = 0u; uKernel < 2u; ++uKernel) {
+        size_t   uHitsNumb = 0u;
+        uint64_t uStartNs  = prvGetTimeNs();
+
+        for (size_t uRep = 0u; uRep < benchSCAN_REPEAT_NUMB; ++uRep) {
+            size_t uPos = 0u;
+
+            while (uPos < benchSCAN_MEM_SIZE) {
+                size_t uLen = benchSCAN_MEM_SIZE - uPos;
+                size_t uIdx =
+                    (uKernel == 0u)
+                        ? prvFindSyncWordByMemchr(&pMem[uPos], uLen)
+                        : RMP_FindSyncWord(
+                              &pMem[uPos],
+                              uLen,
+                              rmpSTART_FRAME_FIRST_BYTE,
+                              rmpSTART_FRAME_SECOND_BYTE);
+
+                if (uIdx < uLen) {
+                    uHitsNumb++;
+                }
+
+                uPos += uIdx + 1u;
+            }
+        }
+
+        double dSec = (double) (prvGetTimeNs() - uStartNs) * 1e-9;
+        double dGBps =
+            (double) benchSCAN_MEM_SIZE * benchSCAN_REPEAT_NUMB / dSec * 1e-9;
+
+        printf(
+            "scan_kernel     %-18s %-16s %8.2f GB/s (hits: %zu)\n",
+            prvGetDataName(eData),
+            (uKernel == 0u) ? "memchr" : "RMP_FindSyncWord",
+            dGBps,
+            uHitsNumb);
+    }
+
+    free(pMem);
+}
+
+static void
+prvBenchScanProcessing(bench_data_e eData)
+{
+    static uint8_t   ucRbMemAlloc[benchRING_SIZE];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+    /* Весь шум отбрасывается за один вызов Processing() */
+    xInit.uReadBytesThreshold  = 0u;
+
+    rmp_api_handle_t hAPI      = RMP_Ctor(&xInit);
+    if (hAPI == NULL) {
+        return;
+    }
+
+    uint8_t *pMem = malloc(benchSCAN_MEM_SIZE);
+    prvFillData(pMem, benchSCAN_MEM_SIZE, eData);
+
+    rmp_package_generic_t xDstMem;
+    uint64_t              uSpentNs = 0u;
+
+    for (size_t uRep = 0u; uRep < benchSCAN_REPEAT_NUMB; ++uRep) {
+        size_t uPos = 0u;
+
+        while (uPos < benchSCAN_MEM_SIZE) {
+            uPos += hAPI->Put(hAPI, &pMem[uPos], benchSCAN_MEM_SIZE - uPos);
+
+            /* Время записи в буфер не учитывается */
+            uint64_t uStartNs = prvGetTimeNs();
+            while (RMP_RingGetFull(&xDataMemAlloc.xRing) != 0u) {
+                hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem));
+            }
+            uSpentNs += prvGetTimeNs() - uStartNs;
+        }
+    }
+
+    double dGBps = (double) benchSCAN_MEM_SIZE * benchSCAN_REPEAT_NUMB
+                   / ((double) uSpentNs * 1e-9) * 1e-9;
+
+    printf(
+        "scan_processing %-18s %-16s %8.2f GB/s\n",
+        prvGetDataName(eData),
+        "Processing",
+        dGBps);
+
+    free(pMem);
+    RMP_Dtor(hAPI);
+}
+
+/**
+ * @brief Формирует поток сообщений, разделенных случайными байтами. В каждом
+ * четвертом сообщении полезная нагрузка содержит пару байт начала сообщения
+ * (например, как часть телеметрии).
+ *
+ * @return Размер потока в байтах.
+ */
+static size_t
+prvMakeFramesStream(uint8_t *pMem, size_t uFramesNumb, size_t *puFrameOffset)
+{
+    uint32_t uSeed = 0xC0FFEEu;
+    size_t   uPos  = 0u;
+
+    for (size_t i = 0u; i < uFramesNumb; ++i) {
+        size_t uGapLen = prvRand(&uSeed) % 4u;
+        for (size_t j = 0u; j < uGapLen; ++j) {
+            pMem[uPos++] = (uint8_t) prvRand(&uSeed);
+        }
+
+        rmp_package_generic_t *pPack = (rmp_package_generic_t *) &pMem[uPos];
+        pPack->xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+        pPack->xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+        for (size_t j = 0u; j < sizeof(pPack->xPLoad.uDummy); ++j) {
+            pPack->xPLoad.uDummy[j] = (uint8_t) prvRand(&uSeed);
+        }
+
+        if ((prvRand(&uSeed) % 4u) == 0u) {
+            size_t uIdx = prvRand(&uSeed) % (sizeof(pPack->xPLoad.uDummy) - 1u);
+            pPack->xPLoad.uDummy[uIdx]      = rmpSTART_FRAME_FIRST_BYTE;
+            pPack->xPLoad.uDummy[uIdx + 1u] = rmpSTART_FRAME_SECOND_BYTE;
+        }
+
+        RPM_WriteCrcInMessageTail((void *) pPack);
+
+        puFrameOffset[i] = uPos;
+        uPos += sizeof(rmp_package_generic_t);
+    }
+
+    return (uPos);
+}
+
+/**
+ * @brief Инвертирует биты потока с заданной вероятностью ошибки на бит.
+ * Расстояние между ошибками имеет геометрическое распределение.
+ */
+static void
+prvInjectBitErrors(uint8_t *pMem, size_t uLen, double dBer)
+{
+    if (dBer <= 0.0) {
+        return;
+    }
+
+    uint32_t uSeed   = 0xBADC0DEu;
+    size_t   uBitIdx = 0u;
+
+    while (1) {
+        double dU = ((double) prvRand(&uSeed) + 1.0) / 4294967296.0;
+        uBitIdx += (size_t) (-log(dU) / dBer);
+
+        if (uBitIdx >= (uLen * 8u)) {
+            break;
+        }
+
+        pMem[uBitIdx / 8u] ^= (uint8_t) (1u << (uBitIdx % 8u));
+        uBitIdx++;
+    }
+}
+
+static void
+prvBenchResync(void)
+{
+    const double daBer[] = {0.0, 1e-5, 1e-4, 1e-3, 1e-2};
+
+    size_t   uMemSize =
+        benchRESYNC_FRAMES_NUMB * (sizeof(rmp_package_generic_t) + 4u);
+    uint8_t *pRef          = malloc(uMemSize);
+    uint8_t *pMem          = malloc(uMemSize);
+    size_t  *puFrameOffset = malloc(benchRESYNC_FRAMES_NUMB * sizeof(size_t));
+
+    size_t uLen =
+        prvMakeFramesStream(pRef, benchRESYNC_FRAMES_NUMB, puFrameOffset);
+
+    for (size_t uBerIdx = 0u; uBerIdx < sizeof(daBer) / sizeof(daBer[0]);
+         ++uBerIdx) {
+        memcpy(pMem, pRef, uLen);
+        prvInjectBitErrors(pMem, uLen, daBer[uBerIdx]);
+
+        /* Количество неповрежденных сообщений - верхняя граница количества
+         * восстановленных сообщений */
+        size_t uIntactNumb = 0u;
+        for (size_t i = 0u; i < benchRESYNC_FRAMES_NUMB; ++i) {
+            if (memcmp(
+                    &pMem[puFrameOffset[i]],
+                    &pRef[puFrameOffset[i]],
+                    sizeof(rmp_package_generic_t))
+                == 0) {
+                uIntactNumb++;
+            }
+        }
+
+        for (size_t uMode = 0u; uMode < 2u; ++uMode) {
+            static uint8_t   ucRbMemAlloc[4096];
+            static rmp_obj_t xDataMemAlloc;
+
+            rmp_init_t xInit;
+            RMP_StructInit(&xInit);
+            xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+            xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+            xInit.hData                = &xDataMemAlloc;
+            xInit.bIsResyncOnCrcError  = (uMode != 0u);
+
+            rmp_api_handle_t hAPI      = RMP_Ctor(&xInit);
+            if (hAPI == NULL) {
+                break;
+            }
+
+            rmp_package_generic_t xaDstMem[64];
+            size_t                uRecoveredNumb = 0u;
+            uint64_t              uStartNs       = prvGetTimeNs();
+
+            for (size_t uPos = 0u; uPos < uLen;) {
+                size_t uChunk = uLen - uPos;
+                if (uChunk > benchRESYNC_CHUNK_SIZE) {
+                    uChunk = benchRESYNC_CHUNK_SIZE;
+                }
+
+                uPos += hAPI->Put(hAPI, &pMem[uPos], uChunk);
+
+                size_t uFramesNumb;
+                do {
+                    uFramesNumb = hAPI->ProcessingBatch(
+                        hAPI,
+                        xaDstMem,
+                        sizeof(xaDstMem) / sizeof(xaDstMem[0]),
+                        0u,
+                        NULL);
+                    uRecoveredNumb += uFramesNumb;
+                } while (uFramesNumb != 0u);
+            }
+
+            double dSec = (double) (prvGetTimeNs() - uStartNs) * 1e-9;
+
+            printf(
+                "resync          ber=%-8.0e %-16s sent=%u intact=%zu "
+                "recovered=%zu yield=%6.2f%% %10.0f frames/s\n",
+                daBer[uBerIdx],
+                (uMode != 0u) ? "resync_on_crc" : "drop_on_crc",
+                benchRESYNC_FRAMES_NUMB,
+                uIntactNumb,
+                uRecoveredNumb,
+                100.0 * (double) uRecoveredNumb / (double) uIntactNumb,
+                (double) uRecoveredNumb / dSec);
+
+            RMP_Dtor(hAPI);
+        }
+    }
+
+    free(puFrameOffset);
+    free(pMem);
+    free(pRef);
+}
+
+/**
+ * @brief Сравнение записи потока в буфер при приеме DMA блоками: через
+ * промежуточный буфер DMA и Put() (два копирования каждого байта) и напрямую в
+ * блок GetWriteSpan() с фиксацией CommitWrite() (одно копирование). Время
+ * измеряется только для записи: буфер заполняется блоками до исчерпания
+ * свободного места, затем сообщения извлекаются ProcessingBatch() вне
+ * замера. Копирование блока DMA выполняется в обоих вариантах, количество байт,
+ * скопированных библиотекой, выводится в расчете на одно сообщение.
+ */
+static void
+prvBenchIngest(void)
+{
+    size_t uMemSize =
+        benchRESYNC_FRAMES_NUMB * (sizeof(rmp_package_generic_t) + 4u);
+    uint8_t *pMem          = malloc(uMemSize);
+    size_t  *puFrameOffset = malloc(benchRESYNC_FRAMES_NUMB * sizeof(size_t));
+
+    if ((pMem == NULL) || (puFrameOffset == NULL)) {
+        free(puFrameOffset);
+        free(pMem);
+
+        return;
+    }
+
+    size_t uLen =
+        prvMakeFramesStream(pMem, benchRESYNC_FRAMES_NUMB, puFrameOffset);
+
+    for (size_t uMode = 0u; uMode < 2u; ++uMode) {
+        static uint8_t   ucRbMemAlloc[4096];
+        static rmp_obj_t xDataMemAlloc;
+
+        rmp_init_t xInit;
+        RMP_StructInit(&xInit);
+        xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+        xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+        xInit.hData                = &xDataMemAlloc;
+
+        rmp_api_handle_t hAPI      = RMP_Ctor(&xInit);
+        if (hAPI == NULL) {
+            break;
+        }
+
+        static uint8_t        ucDmaMem[benchINGEST_DMA_BLOCK_SIZE];
+        rmp_package_generic_t xaDstMem[64];
+        size_t                uRecoveredNumb = 0u;
+        size_t                uCopiedBytes   = 0u;
+        uint64_t              uIngestNs      = 0u;
+
+        for (size_t uRep = 0u; uRep < benchINGEST_REPEAT_NUMB; ++uRep) {
+            for (size_t uPos = 0u; uPos < uLen;) {
+                uint64_t uStartNs = prvGetTimeNs();
+
+                /* Запись блоками DMA до заполнения буфера */
+                while (uPos < uLen) {
+                    size_t uChunk = uLen - uPos;
+                    if (uChunk > benchINGEST_DMA_BLOCK_SIZE) {
+                        uChunk = benchINGEST_DMA_BLOCK_SIZE;
+                    }
+
+                    size_t uWrittenNumb = 0u;
+
+                    if (uMode == 0u) {
+                        /* DMA записывает блок в собственный буфер, затем
+                         * Put() копирует его в кольцевой буфер */
+                        memcpy(ucDmaMem, &pMem[uPos], uChunk);
+                        uWrittenNumb  = hAPI->Put(hAPI, ucDmaMem, uChunk);
+                        uCopiedBytes += uWrittenNumb;
+                    } else {
+                        /* DMA записывает блок напрямую в кольцевой буфер */
+                        size_t uSpanLen = 0u;
+                        void  *pSpan    = hAPI->GetWriteSpan(hAPI, &uSpanLen);
+                        if (uChunk > uSpanLen) {
+                            uChunk = uSpanLen;
+                        }
+
+                        if (pSpan != NULL) {
+                            memcpy(pSpan, &pMem[uPos], uChunk);
+                        }
+                        uWrittenNumb = hAPI->CommitWrite(hAPI, uChunk);
+                    }
+
+                    uPos += uWrittenNumb;
+
+                    if (uWrittenNumb == 0u) {
+                        break;
+                    }
+                }
+                /* while (uPos < uLen) */
+
+                uIngestNs += prvGetTimeNs() - uStartNs;
+
+                size_t uFramesNumb;
+                do {
+                    uFramesNumb = hAPI->ProcessingBatch(
+                        hAPI,
+                        xaDstMem,
+                        sizeof(xaDstMem) / sizeof(xaDstMem[0]),
+                        0u,
+                        NULL);
+                    uRecoveredNumb += uFramesNumb;
+                } while (uFramesNumb != 0u);
+            }
+        }
+
+        printf(
+            "ingest          dma_block=%-4u %-16s frames=%zu "
+            "lib_copy=%5.1f B/frame %8.2f MB/s\n",
+            benchINGEST_DMA_BLOCK_SIZE,
+            (uMode != 0u) ? "write_span" : "put_copy",
+            uRecoveredNumb,
+            (double) uCopiedBytes / (double) uRecoveredNumb,
+            (double) uLen * benchINGEST_REPEAT_NUMB
+                / ((double) uIngestNs * 1e-9) * 1e-6);
+
+        RMP_Dtor(hAPI);
+    }
+
+    free(puFrameOffset);
+    free(pMem);
+}
+
+/**
+ * @brief Сравнение стоимости извлечения сообщений из кольцевого буфера в
+ * обычной (lwrb) и зеркальной области памяти при большом размере буфера. Время
+ * записи в буфер не учитывается.
+ */
+static void
+prvBenchMirror(void)
+{
+#if (rmpMIRROR_MEM_ENABLE == 1)
+    const size_t auRingSize[] = {
+        64u * 1024u,
+        1024u * 1024u,
+        16u * 1024u * 1024u};
+
+    size_t uMemSize =
+        benchRESYNC_FRAMES_NUMB * (sizeof(rmp_package_generic_t) + 4u);
+    uint8_t *pMem          = malloc(uMemSize);
+    size_t  *puFrameOffset = malloc(benchRESYNC_FRAMES_NUMB * sizeof(size_t));
+
+    size_t uLen =
+        prvMakeFramesStream(pMem, benchRESYNC_FRAMES_NUMB, puFrameOffset);
+
+    for (size_t uSizeIdx = 0u;
+         uSizeIdx < sizeof(auRingSize) / sizeof(auRingSize[0]);
+         ++uSizeIdx) {
+        for (size_t uCase = 0u; uCase < 4u; ++uCase) {
+            bool bIsMirrored = ((uCase & 1u) != 0u);
+            bool bIsAcquire  = ((uCase & 2u) != 0u);
+
+            size_t   uRingSize = auRingSize[uSizeIdx];
+            uint8_t *pRingMem  = bIsMirrored
+                                     ? RMP_MirrorMemAlloc(uRingSize, &uRingSize)
+                                     : malloc(uRingSize);
+            if (pRingMem == NULL) {
+                continue;
+            }
+
+            static rmp_obj_t xDataMemAlloc;
+
+            rmp_init_t xInit;
+            RMP_StructInit(&xInit);
+            xInit.pMemAlloc            = (void *) pRingMem;
+            xInit.uMemAllocSizeInBytes = uRingSize;
+            xInit.hData                = &xDataMemAlloc;
+            xInit.bIsMirroredMem       = bIsMirrored;
+            xInit.uReadBytesThreshold  = 0u;
+
+            rmp_api_handle_t hAPI      = RMP_Ctor(&xInit);
+
+            rmp_package_generic_t xaDstMem[64];
+            size_t                uFramesNumb = 0u;
+            uint64_t              uSpentNs    = 0u;
+
+            for (size_t uRep = 0u; uRep < benchMIRROR_REPEAT_NUMB; ++uRep) {
+                for (size_t uPos = 0u; uPos < uLen;) {
+                    uPos += hAPI->Put(hAPI, &pMem[uPos], uLen - uPos);
+
+                    uint64_t uStartNs = prvGetTimeNs();
+                    if (bIsAcquire) {
+                        const void *pFrame;
+                        while ((pFrame = hAPI->AcquireFrame(hAPI)) != NULL) {
+                            hAPI->ReleaseFrame(hAPI);
+                            uFramesNumb++;
+                        }
+                    } else {
+                        size_t uNumb;
+                        do {
+                            uNumb = hAPI->ProcessingBatch(
+                                hAPI,
+                                xaDstMem,
+                                sizeof(xaDstMem) / sizeof(xaDstMem[0]),
+                                0u,
+                                NULL);
+                            uFramesNumb += uNumb;
+                        } while (uNumb != 0u);
+                    }
+                    uSpentNs += prvGetTimeNs() - uStartNs;
+                }
+            }
+
+            printf(
+                "mirror          ring=%-6zuKiB %-8s %-16s frames=%zu "
+                "%6.2f ns/frame\n",
+                uRingSize / 1024u,
+                bIsMirrored ? "mirror" : "lwrb",
+                bIsAcquire ? "AcquireFrame" : "ProcessingBatch",
+                uFramesNumb,
+                (double) uSpentNs / (double) uFramesNumb);
+
+            RMP_Dtor(hAPI);
+
+            if (bIsMirrored) {
+                RMP_MirrorMemFree(pRingMem, uRingSize);
+            } else {
+                free(pRingMem);
+            }
+        }
+    }
+
+    free(puFrameOffset);
+    free(pMem);
+#endif
+}
+
+/**
+ * @brief Формирует поток сообщений, между которыми расположены случайные байты
+ * (доля <dNoiseRatio> от размера потока). Контрольная сумма доли
+ * <dCrcFailRate> сообщений искажена.
+ *
+ * @return Размер потока в байтах.
+ */
+static size_t
+prvMakeMatrixStream(
+    uint8_t *pMem,
+    size_t   uFramesNumb,
+    double   dNoiseRatio,
+    double   dCrcFailRate,
+    size_t  *puValidFramesNumb)
+{
+    const size_t uFrameSize = sizeof(rmp_package_generic_t);
+
+    /* Средняя длина промежутка между сообщениями */
+    const double dGapLen =
+        (double) uFrameSize * dNoiseRatio / (1.0 - dNoiseRatio);
+
+    uint32_t uSeed      = 0x5EED5EEDu;
+    size_t   uPos       = 0u;
+    size_t   uValidNumb = 0u;
+
+    for (size_t i = 0u; i < uFramesNumb; ++i) {
+        size_t uGapLen = 0u;
+        if (dGapLen > 0.0) {
+            uGapLen = prvRand(&uSeed) % (size_t) (2.0 * dGapLen + 1.0);
+        }
+
+        for (size_t j = 0u; j < uGapLen; ++j) {
+            pMem[uPos++] = (uint8_t) prvRand(&uSeed);
+        }
+
+        rmp_package_generic_t *pPack = (rmp_package_generic_t *) &pMem[uPos];
+        pPack->xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+        pPack->xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+        for (size_t j = 0u; j < sizeof(pPack->xPLoad.uDummy); ++j) {
+            pPack->xPLoad.uDummy[j] = (uint8_t) prvRand(&uSeed);
+        }
+
+        RPM_WriteCrcInMessageTail((void *) pPack);
+
+        if (((double) prvRand(&uSeed) / 4294967296.0) < dCrcFailRate) {
+            pPack->uCrc ^= 0x0101u;
+        } else {
+            uValidNumb++;
+        }
+
+        uPos += uFrameSize;
+    }
+
+    *puValidFramesNumb = uValidNumb;
+
+    return (uPos);
+}
+
+/**
+ * @brief Запись потока блоками по <uChunkSize> байт в кольцевой буфер размером
+ * <uRingSize> и извлечение сообщений Processing() после каждой записи.
+ *
+ * @return Затраченное время в наносекундах.
+ */
+static uint64_t
+prvBenchMatrixCase(
+    uint8_t *pMem,
+    size_t   uLen,
+    size_t   uRingSize,
+    size_t   uChunkSize,
+    size_t  *puFramesNumb)
+{
+    uint8_t         *pRingMem = malloc(uRingSize);
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) pRingMem;
+    xInit.uMemAllocSizeInBytes = uRingSize;
+    xInit.hData                = &xDataMemAlloc;
+    xInit.uReadBytesThreshold  = 0u;
+
+    rmp_api_handle_t hAPI      = RMP_Ctor(&xInit);
+
+    rmp_package_generic_t xDstMem;
+    size_t                uFramesNumb = 0u;
+    uint64_t              uStartNs    = prvGetTimeNs();
+
+    for (size_t uPos = 0u; uPos < uLen;) {
+        size_t uChunk = uLen - uPos;
+        if (uChunk > uChunkSize) {
+            uChunk = uChunkSize;
+        }
+
+        uPos += hAPI->Put(hAPI, &pMem[uPos], uChunk);
+
+        /* Processing() вызывается до опустошения буфера */
+        do {
+            if (hAPI->Processing(hAPI, &xDstMem, sizeof(xDstMem)) != 0u) {
+                uFramesNumb++;
+            }
+        } while (RMP_GetStopReason(hAPI) != rmpSTOP_REASON_NO_DATA);
+    }
+
+    uint64_t uSpentNs = prvGetTimeNs() - uStartNs;
+
+    RMP_Dtor(hAPI);
+    free(pRingMem);
+
+    *puFramesNumb = uFramesNumb;
+
+    return (uSpentNs);
+}
+
+/**
+ * @brief Матрица замеров записи потока Put() и извлечения сообщений
+ * Processing(): размер кольцевого буфера, размер блока записи (от одного байта
+ * до блока DMA), доля шума в потоке и доля сообщений с недостоверной
+ * контрольной суммой. Результаты выводятся в stdout и, если задан <pJson>, в
+ * формате JSON для сравнения между версиями.
+ */
+static void
+prvBenchMatrix(FILE *pJson)
+{
+    const size_t auRingSize[]    = {256u, 4096u, 64u * 1024u};
+    const size_t auChunkSize[]   = {1u, 8u, 64u, 512u, 4096u};
+    const double adNoiseRatio[]  = {0.0, 0.25, 0.5};
+    const double adCrcFailRate[] = {0.0, 0.01, 0.1};
+
+    const size_t uRingNumb  = sizeof(auRingSize) / sizeof(auRingSize[0]);
+    const size_t uChunkNumb = sizeof(auChunkSize) / sizeof(auChunkSize[0]);
+    const size_t uNoiseNumb = sizeof(adNoiseRatio) / sizeof(adNoiseRatio[0]);
+    const size_t uCrcNumb   = sizeof(adCrcFailRate) / sizeof(adCrcFailRate[0]);
+
+    /* Промежуток между сообщениями не превышает удвоенной средней длины,
+     * т.е. двух размеров сообщения при доле шума 0.5 */
+    uint8_t *pMem =
+        malloc(benchMATRIX_FRAMES_NUMB * 3u * sizeof(rmp_package_generic_t));
+    bool bIsFirst = true;
+
+    if (pJson != NULL) {
+        fprintf(
+            pJson,
+            "{\n  \"version\": \"%s\",\n  \"state_engine\": \"%s\",\n"
+            "  \"ring_backend\": \"%s\",\n"
+            "  \"frame_size\": %zu,\n  \"frames\": %u,\n  \"results\": [",
+            benchRMP_VERSION,
+            benchSTATE_ENGINE_NAME,
+            benchRING_BACKEND_NAME,
+            sizeof(rmp_package_generic_t),
+            benchMATRIX_FRAMES_NUMB);
+    }
+
+    for (size_t uCase = 0u;
+         uCase < (uNoiseNumb * uCrcNumb * uRingNumb * uChunkNumb);
+         ++uCase) {
+        const double dNoiseRatio  = adNoiseRatio[uCase % uNoiseNumb];
+        const double dCrcFailRate =
+            adCrcFailRate[(uCase / uNoiseNumb) % uCrcNumb];
+        const size_t uRingSize =
+            auRingSize[(uCase / (uNoiseNumb * uCrcNumb)) % uRingNumb];
+        const size_t uChunkSize =
+            auChunkSize[uCase / (uNoiseNumb * uCrcNumb * uRingNumb)];
+
+        /* Блок записи должен помещаться в кольцевой буфер */
+        if (uChunkSize >= uRingSize) {
+            continue;
+        }
+
+        size_t uValidNumb = 0u;
+        size_t uLen       = prvMakeMatrixStream(
+            pMem,
+            benchMATRIX_FRAMES_NUMB,
+            dNoiseRatio,
+            dCrcFailRate,
+            &uValidNumb);
+
+        size_t uFramesNumb = 0u;
+        double dNs         = (double) prvBenchMatrixCase(
+            pMem,
+            uLen,
+            uRingSize,
+            uChunkSize,
+            &uFramesNumb);
+
+        const double dNsPerFrame =
+            (uFramesNumb != 0u) ? dNs / (double) uFramesNumb : 0.0;
+        const double dMbPerSec = (double) uLen / dNs * 1e3;
+
+        printf(
+            "matrix          ring=%-6zu chunk=%-5zu noise=%-4.2f "
+            "crc_fail=%-4.2f frames=%zu/%zu %8.2f ns/frame %8.2f MB/s\n",
+            uRingSize,
+            uChunkSize,
+            dNoiseRatio,
+            dCrcFailRate,
+            uFramesNumb,
+            uValidNumb,
+            dNsPerFrame,
+            dMbPerSec);
+
+        if (pJson != NULL) {
+            fprintf(
+                pJson,
+                "%s\n    {\"ring_size\": %zu, \"chunk_size\": %zu, "
+                "\"noise_ratio\": %.2f, \"crc_fail_rate\": %.2f, "
+                "\"stream_bytes\": %zu, \"valid_frames\": %zu, "
+                "\"delivered_frames\": %zu, \"ns_per_frame\": %.3f, "
+                "\"mb_per_s\": %.3f}",
+                bIsFirst ? "" : ",",
+                uRingSize,
+                uChunkSize,
+                dNoiseRatio,
+                dCrcFailRate,
+                uLen,
+                uValidNumb,
+                uFramesNumb,
+                dNsPerFrame,
+                dMbPerSec);
+
+            bIsFirst = false;
+        }
+    }
+    /* for (size_t uCase = 0u; ...) */
+
+    if (pJson != NULL) {
+        fprintf(pJson, "\n  ]\n}\n");
+    }
+
+    free(pMem);
+}
+
+/**
+ * @brief Передача сообщений через имитатор радиоканала (см.
+ * <rmp_channel_sim.h>): доля полученных сообщений и процессорное время
+ * обработчика на отправленное сообщение при разном качестве канала и режиме
+ * восстановления синхронизации.
+ */
+static void
+prvBenchChannel(void)
+{
+    static const struct
+    {
+        const char *pName;
+        double      dBitErrorRate;
+        double      dByteDropRate;
+        double      dOutageRate;
+    } xaChannel[] = {
+        {"clean", 0.0, 0.0, 0.0},
+        {"ber_1e-5", 1e-5, 0.0, 0.0},
+        {"ber_1e-4", 1e-4, 0.0, 0.0},
+        {"ber_1e-3", 1e-3, 0.0, 0.0},
+        {"drop_1e-4", 0.0, 1e-4, 0.0},
+        {"outage_1e-2", 0.0, 0.0, 1e-2},
+        {"mixed", 1e-4, 1e-4, 1e-3},
+    };
+
+    for (size_t uChIdx = 0u; uChIdx < sizeof(xaChannel) / sizeof(xaChannel[0]);
+         ++uChIdx) {
+        for (size_t uMode = 0u; uMode < 2u; ++uMode) {
+            static uint8_t   ucRbMemAlloc[4096];
+            static rmp_obj_t xDataMemAlloc;
+
+            rmp_init_t xInit;
+            RMP_StructInit(&xInit);
+            xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+            xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+            xInit.hData                = &xDataMemAlloc;
+            xInit.uReadBytesThreshold  = 0u;
+            xInit.bIsResyncOnCrcError  = (uMode != 0u);
+
+            rmp_api_handle_t hAPI      = RMP_Ctor(&xInit);
+
+            rmp_channel_sim_init_t xSimInit;
+            RMP_ChannelSimStructInit(&xSimInit);
+            xSimInit.uGapMaxSizeInBytes    = 8u;
+            xSimInit.dBitErrorRate         = xaChannel[uChIdx].dBitErrorRate;
+            xSimInit.dByteDropRate         = xaChannel[uChIdx].dByteDropRate;
+            xSimInit.dOutageRate           = xaChannel[uChIdx].dOutageRate;
+            xSimInit.uOutageMaxSizeInBytes = 64u;
+            xSimInit.uChunkSizeInBytes     = 64u;
+            xSimInit.dRateJitter           = 0.5;
+
+            rmp_channel_sim_t        xSim;
+            rmp_channel_sim_result_t xResult;
+
+            if ((hAPI == NULL) || !RMP_ChannelSimInit(&xSim, &xSimInit)
+                || !RMP_ChannelSimRun(
+                    &xSim,
+                    hAPI,
+                    benchCHANNEL_FRAMES_NUMB,
+                    &xResult)) {
+                break;
+            }
+
+            printf(
+                "channel         %-12s %-16s sent=%zu recovered=%zu false=%zu "
+                "goodput=%6.2f%% %8.2f cpu_ns/frame\n",
+                xaChannel[uChIdx].pName,
+                (uMode != 0u) ? "resync_on_crc" : "drop_on_crc",
+                xResult.uSentFramesNumb,
+                xResult.uRecoveredFramesNumb,
+                xResult.uFalseFramesNumb,
+                100.0 * (double) xResult.uRecoveredFramesNumb
+                    / (double) xResult.uSentFramesNumb,
+                (double) xResult.uCpuNs / (double) xResult.uSentFramesNumb);
+
+            RMP_Dtor(hAPI);
+        }
+    }
+}
+
+/**
+ * @brief Processing() с объединенной обработкой сообщений, целиком
+ * записанных в буфер (<bIsFastPathEnabled>), в сравнении с обработкой
+ * конечным автоматом при разном размере блока записи.
+ */
+static void
+prvBenchFastPath(void)
+{
+    const size_t uaChunkSize[] = {1u, 20u, 256u, 4096u};
+
+    size_t uMemSize =
+        benchFAST_PATH_FRAMES_NUMB * (sizeof(rmp_package_generic_t) + 4u);
+    uint8_t *pMem          = malloc(uMemSize);
+    size_t  *puFrameOffset =
+        malloc(benchFAST_PATH_FRAMES_NUMB * sizeof(size_t));
+
+    size_t uLen =
+        prvMakeFramesStream(pMem, benchFAST_PATH_FRAMES_NUMB, puFrameOffset);
+
+    for (size_t uChunkIdx = 0u;
+         uChunkIdx < sizeof(uaChunkSize) / sizeof(uaChunkSize[0]);
+         ++uChunkIdx) {
+        double daNsPerFrame[2] = {0.0, 0.0};
+
+        for (size_t uMode = 0u; uMode < 2u; ++uMode) {
+            static uint8_t   ucRbMemAlloc[8192];
+            static rmp_obj_t xDataMemAlloc;
+
+            rmp_init_t xInit;
+            RMP_StructInit(&xInit);
+            xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+            xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+            xInit.hData                = &xDataMemAlloc;
+            xInit.uReadBytesThreshold  = 0u;
+            xInit.bIsFastPathEnabled   = (uMode != 0u);
+
+            rmp_api_handle_t hAPI      = RMP_Ctor(&xInit);
+            if (hAPI == NULL) {
+                break;
+            }
+
+            rmp_package_generic_t xDstMem;
+            size_t                uFramesNumb = 0u;
+            uint64_t              uStartNs    = prvGetTimeNs();
+
+            for (size_t uRep = 0u; uRep < benchFAST_PATH_REPEAT_NUMB; ++uRep) {
+                for (size_t uPos = 0u; uPos < uLen;) {
+                    size_t uChunk = uLen - uPos;
+                    if (uChunk > uaChunkSize[uChunkIdx]) {
+                        uChunk = uaChunkSize[uChunkIdx];
+                    }
+
+                    uPos += hAPI->Put(hAPI, &pMem[uPos], uChunk);
+
+                    /* Сообщение с недостоверной контрольной суммой также
+                     * завершает вызов Processing() */
+                    while (1) {
+                        if (hAPI->Processing(
+                                hAPI,
+                                (void *) &xDstMem,
+                                sizeof(xDstMem))
+                            != 0u) {
+                            uFramesNumb++;
+                        } else if (
+                            RMP_GetStopReason(hAPI)
+                            != rmpSTOP_REASON_FRAMES_BUDGET) {
+                            break;
+                        }
+                    }
+                }
+            }
+
+            daNsPerFrame[uMode] = (double) (prvGetTimeNs() - uStartNs)
+                                  / (double) uFramesNumb;
+
+            printf(
+                "fast_path       chunk=%-5zu %-14s frames=%zu %8.2f "
+                "ns/frame\n",
+                uaChunkSize[uChunkIdx],
+                (uMode != 0u) ? "fused" : "state_machine",
+                uFramesNumb,
+                daNsPerFrame[uMode]);
+
+            RMP_Dtor(hAPI);
+        }
+
+        printf(
+            "fast_path       chunk=%-5zu speedup=%.2fx\n",
+            uaChunkSize[uChunkIdx],
+            daNsPerFrame[0] / daNsPerFrame[1]);
+    }
+
+    free(puFrameOffset);
+    free(pMem);
+}
+
+/**
+ * @brief Большое количество экземпляров обработчика в одном процессе (шлюз):
+ * каждому экземпляру записывается блок размером с сообщение и вызывается
+ * Processing(). Объекты выровнены на строку кэша (<rmpCACHE_LINE_SIZE>), а
+ * экземпляры обходятся в случайном порядке (перестановка с фиксированным
+ * начальным значением), поэтому аппаратная предвыборка не загружает
+ * следующий объект заранее. Между обращениями к экземпляру объект
+ * вытесняется из кэша, поэтому время определяется количеством строк кэша
+ * объекта, к которым обращается обработчик.
+ */
+static void
+prvBenchInstances(void)
+{
+    /* Шаг размещения объектов кратен строке кэша */
+    const size_t uObjStride =
+        (sizeof(rmp_obj_t) + rmpCACHE_LINE_SIZE - 1u)
+        / rmpCACHE_LINE_SIZE * rmpCACHE_LINE_SIZE;
+
+    uint8_t          *pObjMem  =
+        aligned_alloc(rmpCACHE_LINE_SIZE, benchINSTANCES_NUMB * uObjStride);
+    uint8_t          *pRbMem   =
+        malloc(benchINSTANCES_NUMB * benchINSTANCES_RING_SIZE);
+    rmp_api_handle_t *phAPI    =
+        malloc(benchINSTANCES_NUMB * sizeof(rmp_api_handle_t));
+    size_t           *puOrder  = malloc(benchINSTANCES_NUMB * sizeof(size_t));
+    uint8_t          *pMem     = malloc(
+        benchINSTANCES_ROUNDS_NUMB * (sizeof(rmp_package_generic_t) + 4u));
+    size_t           *puOffset =
+        malloc(benchINSTANCES_ROUNDS_NUMB * sizeof(size_t));
+
+    if ((pObjMem == NULL) || (pRbMem == NULL) || (phAPI == NULL)
+        || (puOrder == NULL) || (pMem == NULL) || (puOffset == NULL)) {
+        free(puOffset);
+        free(pMem);
+        free(puOrder);
+        free(phAPI);
+        free(pRbMem);
+        free(pObjMem);
+
+        return;
+    }
+
+    size_t uLen =
+        prvMakeFramesStream(pMem, benchINSTANCES_ROUNDS_NUMB, puOffset);
+
+    size_t uCtorNumb = 0u;
+    for (size_t i = 0u; i < benchINSTANCES_NUMB; ++i) {
+        rmp_init_t xInit;
+        RMP_StructInit(&xInit);
+        xInit.pMemAlloc            = &pRbMem[i * benchINSTANCES_RING_SIZE];
+        xInit.uMemAllocSizeInBytes = benchINSTANCES_RING_SIZE;
+        xInit.hData                = (rmp_obj_t *) &pObjMem[i * uObjStride];
+
+        phAPI[i] = RMP_Ctor(&xInit);
+        if (phAPI[i] == NULL) {
+            break;
+        }
+
+        uCtorNumb++;
+    }
+
+    /* Порядок обхода экземпляров (Fisher-Yates) */
+    uint32_t uSeed = 0xBADC0DEu;
+    for (size_t i = 0u; i < uCtorNumb; ++i) {
+        puOrder[i] = i;
+    }
+    for (size_t i = uCtorNumb; i > 1u; --i) {
+        size_t j        = prvRand(&uSeed) % i;
+        size_t uTmp     = puOrder[i - 1u];
+        puOrder[i - 1u] = puOrder[j];
+        puOrder[j]      = uTmp;
+    }
+
+    const size_t          uChunk      = sizeof(rmp_package_generic_t);
+    rmp_package_generic_t xDstMem;
+    size_t                uFramesNumb = 0u;
+    uint64_t              uStartNs    = prvGetTimeNs();
+
+    for (size_t uPos = 0u; (uPos + uChunk) <= uLen; uPos += uChunk) {
+        for (size_t i = 0u; i < uCtorNumb; ++i) {
+            rmp_api_handle_t hAPI = phAPI[puOrder[i]];
+
+            hAPI->Put(hAPI, &pMem[uPos], uChunk);
+
+            while (1) {
+                if (hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem))
+                    != 0u) {
+                    uFramesNumb++;
+                } else if (
+                    RMP_GetStopReason(hAPI) != rmpSTOP_REASON_FRAMES_BUDGET) {
+                    break;
+                }
+            }
+        }
+    }
+
+    printf(
+        "instances       numb=%-6zu obj_size=%-4zu frames=%zu %8.2f "
+        "ns/frame\n",
+        uCtorNumb,
+        sizeof(rmp_obj_t),
+        uFramesNumb,
+        (double) (prvGetTimeNs() - uStartNs) / (double) uFramesNumb);
+
+    for (size_t i = 0u; i < uCtorNumb; ++i) {
+        RMP_Dtor(phAPI[i]);
+    }
+
+    free(puOffset);
+    free(pMem);
+    free(puOrder);
+    free(phAPI);
+    free(pRbMem);
+    free(pObjMem);
+}
+
+/**
+ * @brief Параметры потока производителя замера prvBenchThreads().
+ */
+typedef struct
+{
+    rmp_api_handle_t hAPI;
+    const uint8_t   *pMem;
+    size_t           uLen;
+    size_t           uChunkSize;
+    atomic_bool      bIsDone;
+} bench_producer_t;
+
+static void *
+prvProducerThread(void *pArg)
+{
+    bench_producer_t *pxProducer = (bench_producer_t *) pArg;
+    rmp_api_handle_t  hAPI       = pxProducer->hAPI;
+    size_t            uPos       = 0u;
+
+    /* При заполненном буфере запись повторяется до освобождения места */
+    while (uPos < pxProducer->uLen) {
+        size_t uChunk = pxProducer->uLen - uPos;
+        if (uChunk > pxProducer->uChunkSize) {
+            uChunk = pxProducer->uChunkSize;
+        }
+
+        size_t uWritten =
+            hAPI->Put(hAPI, (void *) &pxProducer->pMem[uPos], uChunk);
+        if (uWritten == 0u) {
+            sched_yield();
+        }
+
+        uPos += uWritten;
+    }
+
+    atomic_store_explicit(&pxProducer->bIsDone, true, memory_order_release);
+
+    return (NULL);
+}
+
+/**
+ * @brief Put() и Processing() одного экземпляра обработчика в разных потоках
+ * (поток приема и поток обработки) при разном размере блока записи. Время
+ * определяется обменом строками кэша с позициями чтения и записи кольцевого
+ * буфера между ядрами (см. RMP_RING_BACKEND). Полученные сообщения
+ * сравниваются с отправленными: порядок сообщений должен сохраняться.
+ *
+ * Ожидающий поток уступает процессор (sched_yield()), поэтому при одном ядре
+ * время определяется планировщиком.
+ */
+static void
+prvBenchThreads(void)
+{
+    const size_t auChunkSize[] = {1u, 16u, 256u};
+
+    uint8_t *pMem = malloc(
+        benchTHREADS_FRAMES_NUMB * (sizeof(rmp_package_generic_t) + 4u));
+    size_t  *puOffset = malloc(benchTHREADS_FRAMES_NUMB * sizeof(size_t));
+
+    if ((pMem == NULL) || (puOffset == NULL)) {
+        free(puOffset);
+        free(pMem);
+
+        return;
+    }
+
+    size_t uLen =
+        prvMakeFramesStream(pMem, benchTHREADS_FRAMES_NUMB, puOffset);
+
+    for (size_t uIdx = 0u; uIdx < sizeof(auChunkSize) / sizeof(auChunkSize[0]);
+         ++uIdx) {
+        static uint8_t   ucRbMemAlloc[benchTHREADS_RING_SIZE];
+        static rmp_obj_t xDataMemAlloc;
+
+        rmp_init_t xInit;
+        RMP_StructInit(&xInit);
+        xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+        xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+        xInit.hData                = &xDataMemAlloc;
+        xInit.uReadBytesThreshold  = 0u;
+
+        bench_producer_t xProducer;
+        xProducer.hAPI       = RMP_Ctor(&xInit);
+        xProducer.pMem       = pMem;
+        xProducer.uLen       = uLen;
+        xProducer.uChunkSize = auChunkSize[uIdx];
+        atomic_init(&xProducer.bIsDone, false);
+
+        if (xProducer.hAPI == NULL) {
+            break;
+        }
+
+        rmp_api_handle_t      hAPI        = xProducer.hAPI;
+        rmp_package_generic_t xDstMem;
+        size_t                uFramesNumb = 0u;
+        size_t                uErrorsNumb = 0u;
+        size_t                uSentIdx    = 0u;
+        bool                  bIsDone     = false;
+        pthread_t             xThread;
+        uint64_t              uStartNs    = prvGetTimeNs();
+
+        if (pthread_create(&xThread, NULL, prvProducerThread, &xProducer)
+            != 0) {
+            RMP_Dtor(hAPI);
+            break;
+        }
+
+        /* Признак завершения записи считывается до последнего вызова
+         * Processing(), поэтому после него в буфере остаются только байты
+         * после последнего сообщения */
+        while (1) {
+            if (hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem))
+                != 0u) {
+                /* Сообщение ищется среди отправленных после предыдущего
+                 * полученного (сообщения, содержащие пару байт начала
+                 * сообщения, могут быть пропущены) */
+                size_t uFrameIdx = uSentIdx;
+                while ((uFrameIdx < benchTHREADS_FRAMES_NUMB)
+                       && (memcmp(
+                               &xDstMem,
+                               &pMem[puOffset[uFrameIdx]],
+                               sizeof(xDstMem))
+                           != 0)) {
+                    uFrameIdx++;
+                }
+
+                if (uFrameIdx < benchTHREADS_FRAMES_NUMB) {
+                    uSentIdx = uFrameIdx + 1u;
+                } else {
+                    uErrorsNumb++;
+                }
+
+                uFramesNumb++;
+            } else if (
+                RMP_GetStopReason(hAPI) != rmpSTOP_REASON_FRAMES_BUDGET) {
+                if (bIsDone) {
+                    break;
+                }
+
+                bIsDone = atomic_load_explicit(
+                    &xProducer.bIsDone,
+                    memory_order_acquire);
+                sched_yield();
+            }
+        }
+
+        const uint64_t uNs = prvGetTimeNs() - uStartNs;
+        pthread_join(xThread, NULL);
+
+        printf(
+            "threads         ring=%-5u chunk=%-4zu backend=%s frames=%zu/%u "
+            "errors=%zu %8.2f ns/frame %8.2f MB/s\n",
+            benchTHREADS_RING_SIZE,
+            auChunkSize[uIdx],
+            benchRING_BACKEND_NAME,
+            uFramesNumb,
+            benchTHREADS_FRAMES_NUMB,
+            uErrorsNumb,
+            (double) uNs / (double) uFramesNumb,
+            (double) uLen / (double) uNs * 1e3);
+
+        RMP_Dtor(hAPI);
+    }
+
+    free(puOffset);
+    free(pMem);
+}
+
+/**
+ * @brief Обращения обработчика к кольцевому буферу в замере prvBenchRing().
+ */
+typedef enum
+{
+    /* Чтение по одному байту (поиск 2-го байта начала сообщения) */
+    benchRING_PATTERN_BYTE = 0,
+
+    /* Проверка заполнения, чтение заголовка и сообщения целиком (ожидание и
+     * копирование сообщения) */
+    benchRING_PATTERN_FRAME,
+
+    /* Линейный блок и пропуск байт (поиск пары байт начала сообщения) */
+    benchRING_PATTERN_SPAN,
+
+    benchRING_PATTERN_MAX_NUMB,
+} bench_ring_pattern_e;
+
+static const char *const pcRingPatternName[benchRING_PATTERN_MAX_NUMB] = {
+    "byte",
+    "frame",
+    "span",
+};
+
+/**
+ * @brief Обращения <ePattern> к кольцевому буферу lwrb.
+ *
+ * @return Количество операций чтения.
+ */
+static size_t
+prvRunRingPatternLwrb(
+    lwrb_t              *pRb,
+    bench_ring_pattern_e ePattern,
+    const uint8_t       *pMem,
+    size_t               uLen,
+    uint32_t            *puSum)
+{
+    rmp_package_generic_t xDstMem;
+    size_t                uOpsNumb = 0u;
+
+    for (size_t uPos = 0u; (uPos + benchRING_CHUNK_SIZE) <= uLen;
+         uPos += benchRING_CHUNK_SIZE) {
+        lwrb_write(pRb, &pMem[uPos], benchRING_CHUNK_SIZE);
+
+        if (ePattern == benchRING_PATTERN_BYTE) {
+            uint8_t uByte = 0u;
+            while (lwrb_read(pRb, &uByte, 1u) != 0u) {
+                *puSum += uByte;
+                uOpsNumb++;
+            }
+        } else if (ePattern == benchRING_PATTERN_FRAME) {
+            while (lwrb_get_full(pRb) >= sizeof(xDstMem)) {
+                lwrb_peek(pRb, 0u, &xDstMem, 2u);
+                lwrb_read(pRb, &xDstMem, sizeof(xDstMem));
+                *puSum += xDstMem.uCrc;
+                uOpsNumb++;
+            }
+        } else {
+            size_t uSpanLen = 0u;
+            while ((uSpanLen = lwrb_get_linear_block_read_length(pRb)) != 0u) {
+                const uint8_t *pSpan =
+                    lwrb_get_linear_block_read_address(pRb);
+                *puSum += pSpan[uSpanLen - 1u];
+                lwrb_skip(pRb, uSpanLen);
+                uOpsNumb++;
+            }
+        }
+    }
+
+    return (uOpsNumb);
+}
+
+/**
+ * @brief Обращения <ePattern> к кольцевому буферу <rmpRING_BACKEND>.
+ *
+ * @return Количество операций чтения.
+ */
+static size_t
+prvRunRingPattern(
+    rmp_ring_t          *pRb,
+    bench_ring_pattern_e ePattern,
+    const uint8_t       *pMem,
+    size_t               uLen,
+    uint32_t            *puSum)
+{
+    rmp_package_generic_t xDstMem;
+    size_t                uOpsNumb = 0u;
+
+    for (size_t uPos = 0u; (uPos + benchRING_CHUNK_SIZE) <= uLen;
+         uPos += benchRING_CHUNK_SIZE) {
+        RMP_RingWrite(pRb, &pMem[uPos], benchRING_CHUNK_SIZE);
+
+        if (ePattern == benchRING_PATTERN_BYTE) {
+            uint8_t uByte = 0u;
+            while (RMP_RingRead(pRb, &uByte, 1u) != 0u) {
+                *puSum += uByte;
+                uOpsNumb++;
+            }
+        } else if (ePattern == benchRING_PATTERN_FRAME) {
+            while (RMP_RingGetFull(pRb) >= sizeof(xDstMem)) {
+                RMP_RingPeek(pRb, 0u, &xDstMem, 2u);
+                RMP_RingRead(pRb, &xDstMem, sizeof(xDstMem));
+                *puSum += xDstMem.uCrc;
+                uOpsNumb++;
+            }
+        } else {
+            size_t uSpanLen = 0u;
+            while ((uSpanLen = RMP_RingGetReadLength(pRb)) != 0u) {
+                const uint8_t *pSpan = RMP_RingGetReadAddress(pRb);
+                *puSum += pSpan[uSpanLen - 1u];
+                RMP_RingSkip(pRb, uSpanLen);
+                uOpsNumb++;
+            }
+        }
+    }
+
+    return (uOpsNumb);
+}
+
+/**
+ * @brief Операции кольцевого буфера, выбранного при сборке
+ * (RMP_RING_BACKEND), и lwrb при обращениях, характерных для обработчика
+ * сообщений: блоки по <benchRING_CHUNK_SIZE> байт записываются и считываются
+ * по одному байту, сообщениями или линейными блоками.
+ */
+static void
+prvBenchRing(void)
+{
+    static uint8_t ucLwrbMem[4096];
+    static uint8_t ucRingMem[4096];
+
+    uint8_t *pMem =
+        malloc(benchRING_FRAMES_NUMB * (sizeof(rmp_package_generic_t) + 4u));
+    size_t *puOffset = malloc(benchRING_FRAMES_NUMB * sizeof(size_t));
+
+    size_t uLen = prvMakeFramesStream(pMem, benchRING_FRAMES_NUMB, puOffset);
+
+    for (bench_ring_pattern_e ePattern = benchRING_PATTERN_BYTE;
+         ePattern < benchRING_PATTERN_MAX_NUMB;
+         ++ePattern) {
+        lwrb_t     xLwrb;
+        rmp_ring_t xRing;
+        uint32_t   uSum         = 0u;
+        size_t     uLwrbOpsNumb = 0u;
+        size_t     uRingOpsNumb = 0u;
+
+        lwrb_init(&xLwrb, ucLwrbMem, sizeof(ucLwrbMem));
+        RMP_RingInit(&xRing, ucRingMem, sizeof(ucRingMem));
+
+        uint64_t uStartNs = prvGetTimeNs();
+        for (size_t i = 0u; i < benchRING_REPEAT_NUMB; ++i) {
+            uLwrbOpsNumb +=
+                prvRunRingPatternLwrb(&xLwrb, ePattern, pMem, uLen, &uSum);
+        }
+        const double dLwrbNs = (double) (prvGetTimeNs() - uStartNs);
+
+        uStartNs = prvGetTimeNs();
+        for (size_t i = 0u; i < benchRING_REPEAT_NUMB; ++i) {
+            uRingOpsNumb +=
+                prvRunRingPattern(&xRing, ePattern, pMem, uLen, &uSum);
+        }
+        const double dRingNs = (double) (prvGetTimeNs() - uStartNs);
+
+        printf(
+            "ring            pattern=%-6s lwrb=%6.2f ns/op %s=%6.2f ns/op "
+            "speedup=%.2fx (sum=%08x)\n",
+            pcRingPatternName[ePattern],
+            dLwrbNs / (double) uLwrbOpsNumb,
+            benchRING_BACKEND_NAME,
+            dRingNs / (double) uRingOpsNumb,
+            (dLwrbNs / (double) uLwrbOpsNumb)
+                / (dRingNs / (double) uRingOpsNumb),
+            uSum);
+
+        RMP_RingFree(&xRing);
+    }
+
+    free(puOffset);
+    free(pMem);
+}
+
+#if (rmpNOTIFY_ENABLE == 1)
+/**
+ * @brief Поток производителя замера prvBenchNotify(): записывает одно
+ * сообщение за период <benchNOTIFY_PERIOD_NS>.
+ */
+static void *
+prvPacedProducerThread(void *pArg)
+{
+    bench_producer_t *pxProducer = (bench_producer_t *) pArg;
+    rmp_api_handle_t  hAPI       = pxProducer->hAPI;
+    struct timespec   xNext;
+
+    clock_gettime(CLOCK_MONOTONIC, &xNext);
+
+    for (size_t uPos = 0u; uPos < pxProducer->uLen;) {
+        xNext.tv_nsec += benchNOTIFY_PERIOD_NS;
+        if (xNext.tv_nsec >= 1000000000L) {
+            xNext.tv_nsec -= 1000000000L;
+            xNext.tv_sec++;
+        }
+
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &xNext, NULL);
+
+        size_t uChunk = pxProducer->uLen - uPos;
+        if (uChunk > pxProducer->uChunkSize) {
+            uChunk = pxProducer->uChunkSize;
+        }
+
+        uPos += hAPI->Put(hAPI, (void *) &pxProducer->pMem[uPos], uChunk);
+    }
+
+    atomic_store_explicit(&pxProducer->bIsDone, true, memory_order_release);
+
+    return (NULL);
+}
+#endif
+
+/**
+ * @brief Время процессора потока обработки при редком поступлении сообщений:
+ * периодический вызов Processing() (sched_yield() между вызовами) и ожидание
+ * RMP_WaitForFrame() (см. RMP_NOTIFY). Количество ожиданий на сообщение
+ * показывает число системных вызовов пробуждения.
+ */
+static void
+prvBenchNotify(void)
+{
+#if (rmpNOTIFY_ENABLE == 1)
+    static const char *const pcModeName[] = {"poll", "wait"};
+
+    uint8_t *pMem = malloc(
+        benchNOTIFY_FRAMES_NUMB * (sizeof(rmp_package_generic_t) + 4u));
+    size_t  *puOffset = malloc(benchNOTIFY_FRAMES_NUMB * sizeof(size_t));
+
+    size_t uLen =
+        prvMakeFramesStream(pMem, benchNOTIFY_FRAMES_NUMB, puOffset);
+
+    for (size_t uMode = 0u; uMode < 2u; ++uMode) {
+        static uint8_t   ucRbMemAlloc[benchTHREADS_RING_SIZE];
+        static rmp_obj_t xDataMemAlloc;
+
+        rmp_init_t xInit;
+        RMP_StructInit(&xInit);
+        xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+        xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+        xInit.hData                = &xDataMemAlloc;
+        xInit.uReadBytesThreshold  = 0u;
+
+        bench_producer_t xProducer;
+        xProducer.hAPI       = RMP_Ctor(&xInit);
+        xProducer.pMem       = pMem;
+        xProducer.uLen       = uLen;
+        xProducer.uChunkSize = sizeof(rmp_package_generic_t);
+        atomic_init(&xProducer.bIsDone, false);
+
+        if (xProducer.hAPI == NULL) {
+            break;
+        }
+
+        rmp_api_handle_t      hAPI        = xProducer.hAPI;
+        rmp_package_generic_t xDstMem;
+        size_t                uFramesNumb = 0u;
+        size_t                uWaitsNumb  = 0u;
+        bool                  bIsDone     = false;
+        pthread_t             xThread;
+        struct timespec       xCpuStart;
+        struct timespec       xCpuEnd;
+
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &xCpuStart);
+        uint64_t uStartNs = prvGetTimeNs();
+
+        if (pthread_create(
+                &xThread,
+                NULL,
+                prvPacedProducerThread,
+                &xProducer)
+            != 0) {
+            RMP_Dtor(hAPI);
+            break;
+        }
+
+        while (1) {
+            if (hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem))
+                != 0u) {
+                uFramesNumb++;
+            } else if (
+                RMP_GetStopReason(hAPI) != rmpSTOP_REASON_FRAMES_BUDGET) {
+                if (bIsDone) {
+                    break;
+                }
+
+                bIsDone = atomic_load_explicit(
+                    &xProducer.bIsDone,
+                    memory_order_acquire);
+
+                if (uMode == 0u) {
+                    sched_yield();
+                } else {
+                    RMP_WaitForFrame(hAPI, benchNOTIFY_TIMEOUT_MS);
+                }
+
+                uWaitsNumb++;
+            }
+        }
+
+        const uint64_t uNs = prvGetTimeNs() - uStartNs;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &xCpuEnd);
+        pthread_join(xThread, NULL);
+
+        const double dCpuNs =
+            (double) (xCpuEnd.tv_sec - xCpuStart.tv_sec) * 1e9
+            + (double) (xCpuEnd.tv_nsec - xCpuStart.tv_nsec);
+
+        printf(
+            "notify          mode=%s period=%uus frames=%zu/%u "
+            "%8.2f waits/frame %8.2f us_cpu/frame cpu=%5.1f%%\n",
+            pcModeName[uMode],
+            benchNOTIFY_PERIOD_NS / 1000u,
+            uFramesNumb,
+            benchNOTIFY_FRAMES_NUMB,
+            (double) uWaitsNumb / (double) uFramesNumb,
+            dCpuNs / 1e3 / (double) uFramesNumb,
+            dCpuNs / (double) uNs * 100.0);
+
+        RMP_Dtor(hAPI);
+    }
+
+    free(puOffset);
+    free(pMem);
+#endif
+}
@@ -36,6 +36,13 @@
 #include <string.h>
 #include <stdbool.h>
 #include "radio_message_parser.h"
+#include "radio_message_parser_ring.h"
+
+static bool
+prvIsFrameDescValid(const rmp_frame_desc_t *pxDesc);
+
+static size_t
+prvGetMinFrameSize(const rmp_frame_desc_t *pxDesc);
 
 /**
  * @brief Выполняет сброс структуры инициализации в параметры <по умолчанию>.
@@ -49,7 +56,17 @@ RMP_StructInit(rmp_init_t *pxInit)
 {
     memset((void *) pxInit, 0, sizeof(rmp_init_t));
 
-    pxInit->uReadBytesThreshold = rmpONE_MESSAGE_SIZE_IN_BYTES * 2;
+    pxInit->uReadBytesThreshold      = rmpONE_MESSAGE_SIZE_IN_BYTES * 2;
+    pxInit->bIsResyncOnCrcError      = false;
+    pxInit->bIsMirroredMem           = false;
+    pxInit->bIsFastPathEnabled       = true;
+    pxInit->eOverflowPolicy          = rmpOVERFLOW_POLICY_REJECT_NEWEST;
+    pxInit->xFrameDesc               = (rmp_frame_desc_t) rmpFRAME_DESC_DEFAULT;
+    pxInit->pxDispatchTable          = NULL;
+    pxInit->uDispatchTypeOffset      = offsetof(rmp_package_generic_t, xPLoad);
+    pxInit->bIsDropUnregisteredTypes = false;
+    pxInit->pfnGetTimestamp          = NULL;
+    pxInit->uByteDuration            = 0u;
 }
 
 /**
@@ -79,17 +96,64 @@ RMP_Ctor(rmp_init_t *pxInit)
         return (NULL);
     }
 
+    if (prvIsFrameDescValid(&pxInit->xFrameDesc) == false) {
+        return (NULL);
+    }
+
+    if (pxInit->eOverflowPolicy >= rmpOVERFLOW_POLICY_MAX_NUMB) {
+        return (NULL);
+    }
+
+#if (rmpRING_BACKEND != rmpRING_BACKEND_LWRB)
+    /* Остальные политики удаляют байты в Put(), изменяя позицию чтения и
+     * состояние конечного автомата, которые принадлежат потоку обработки */
+    if (pxInit->eOverflowPolicy != rmpOVERFLOW_POLICY_REJECT_NEWEST) {
+        return (NULL);
+    }
+#endif
+
+    /* Байт типа сообщения должен находиться в пределах сообщения
+     * минимального размера */
+    if ((pxInit->pxDispatchTable != NULL)
+        && (pxInit->uDispatchTypeOffset
+            >= prvGetMinFrameSize(&pxInit->xFrameDesc))) {
+        return (NULL);
+    }
+
     bool bIsCtorErrorDetect = false;
 
     rmp_data_handle_t hData = pxInit->hData;
     memset((void *) hData, 0, sizeof(rmp_obj_t));
     /*------------------------------------------------------------------------*/
 
-    hData->uReadBytesThreshold = pxInit->uReadBytesThreshold;
+    hData->uReadBytesThreshold      = pxInit->uReadBytesThreshold;
+    hData->uReadBytesLeft           = SIZE_MAX;
+    hData->eStopReason              = rmpSTOP_REASON_NO_DATA;
+    hData->bIsResyncOnCrcError      = pxInit->bIsResyncOnCrcError;
+    hData->bIsMirroredMem           = pxInit->bIsMirroredMem;
+    hData->bIsFastPathEnabled       = pxInit->bIsFastPathEnabled;
+    hData->eOverflowPolicy          = pxInit->eOverflowPolicy;
+    hData->xFrameDesc               = pxInit->xFrameDesc;
+
+    hData->pxDispatchTable          = pxInit->pxDispatchTable;
+    hData->uDispatchTypeOffset      = pxInit->uDispatchTypeOffset;
+    hData->bIsDropUnregisteredTypes = pxInit->bIsDropUnregisteredTypes;
+
+    if (hData->pxDispatchTable != NULL) {
+        memset(
+            (void *) hData->pxDispatchTable,
+            0,
+            sizeof(rmp_dispatch_entry_t) * rmpDISPATCH_TYPES_NUMB);
+    }
+
+#if (rmpTIMESTAMP_MARKS_ENABLE == 1)
+    hData->pfnGetTimestamp = pxInit->pfnGetTimestamp;
+    hData->uByteDuration   = pxInit->uByteDuration;
+#endif
     /*------------------------------------------------------------------------*/
 
-    if (lwrb_init(
-            &hData->xLWRB,
+    if (RMP_RingInit(
+            &hData->xRing,
             pxInit->pMemAlloc,
             pxInit->uMemAllocSizeInBytes)
         == false) {
@@ -104,6 +168,14 @@ RMP_Ctor(rmp_init_t *pxInit)
     RMP_InitStateAPI(hData);
     /*------------------------------------------------------------------------*/
 
+#if (rmpNOTIFY_ENABLE == 1)
+    if (RMP_NotifyInit(hData, prvGetMinFrameSize(&hData->xFrameDesc))
+        == false) {
+        bIsCtorErrorDetect = true;
+    }
+    /*------------------------------------------------------------------------*/
+#endif
+
     if (bIsCtorErrorDetect == true) {
         RMP_Dtor(hAPI);
 
@@ -123,7 +195,10 @@ RMP_Dtor(rmp_api_handle_t hAPI)
         rmp_data_handle_t hObj = (rmp_data_handle_t) hAPI;
 
         /* Освобождение занимаемых ресурсов */
-        lwrb_free(&hObj->xLWRB);
+        RMP_RingFree(&hObj->xRing);
+#if (rmpNOTIFY_ENABLE == 1)
+        RMP_NotifyDeinit(hObj);
+#endif
         /*--------------------------------------------------------------------*/
 
         bIsObjDestroyed = true;
@@ -132,3 +207,56 @@ RMP_Dtor(rmp_api_handle_t hAPI)
 
     return (bIsObjDestroyed);
 }
+
+/**
+ * @brief Проверяет, что сообщение формата <pxDesc> содержит байты начала
+ * сообщения и контрольную сумму, а область расчета контрольной суммы не
+ * выходит за пределы сообщения.
+ */
+static bool
+prvIsFrameDescValid(const rmp_frame_desc_t *pxDesc)
+{
+    const size_t uFrameSize = pxDesc->uFrameSizeInBytes;
+
+    if ((uFrameSize < (2u + sizeof(uint16_t)))
+        || (uFrameSize > rmpFRAME_MAX_SIZE_IN_BYTES)) {
+        return (false);
+    }
+
+    /* Сообщение переменной длины: длина полезной нагрузки задается одним
+     * байтом, область расчета контрольной суммы начинается не далее начала
+     * полезной нагрузки */
+    if (pxDesc->bIsLengthPrefixed) {
+        return (
+            (uFrameSize >= 5u)
+            && (pxDesc->uMinPayloadSizeInBytes <= (uFrameSize - 5u))
+            && (pxDesc->uMinPayloadSizeInBytes <= UINT8_MAX)
+            && (pxDesc->uCrcCoverageOffset <= 3u));
+    }
+
+    if ((pxDesc->uCrcOffset < 2u)
+        || (pxDesc->uCrcOffset > (uFrameSize - sizeof(uint16_t)))) {
+        return (false);
+    }
+
+    if ((pxDesc->uCrcCoverageOffset > uFrameSize)
+        || (pxDesc->uCrcCoverageSizeInBytes
+            > (uFrameSize - pxDesc->uCrcCoverageOffset))) {
+        return (false);
+    }
+
+    return (true);
+}
+
+/**
+ * @brief Возвращает минимальный размер сообщения формата <pxDesc>.
+ */
+static size_t
+prvGetMinFrameSize(const rmp_frame_desc_t *pxDesc)
+{
+    if (pxDesc->bIsLengthPrefixed) {
+        return (5u + pxDesc->uMinPayloadSizeInBytes);
+    }
+
+    return (pxDesc->uFrameSizeInBytes);
+}
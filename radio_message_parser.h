@@ -183,6 +183,9 @@
     #ifndef __rmpPACKED
         #define __rmpPACKED __attribute__((__packed__))
     #endif
+    #ifndef __rmpFORCE_INLINE
+        #define __rmpFORCE_INLINE inline __attribute__((always_inline))
+    #endif
 #else
     #error "You must define __rmpPACKED for your compiler"
 #endif
@@ -206,6 +209,228 @@
 #ifndef rmpONE_MESSAGE_SIZE_IN_BYTES
     #define rmpONE_MESSAGE_SIZE_IN_BYTES (20)
 #endif
+
+/**
+ * @brief Максимальный размер сообщения, формат которого задается во время
+ * выполнения (см. <rmp_frame_desc_t>). Определяет размер внутреннего буфера
+ * сообщения в <rmp_obj_t>.
+ */
+#ifndef rmpFRAME_MAX_SIZE_IN_BYTES
+    #define rmpFRAME_MAX_SIZE_IN_BYTES (64)
+#endif
+
+#if (rmpFRAME_MAX_SIZE_IN_BYTES < rmpONE_MESSAGE_SIZE_IN_BYTES)
+    #error "rmpFRAME_MAX_SIZE_IN_BYTES less than rmpONE_MESSAGE_SIZE_IN_BYTES"
+#endif
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Алгоритмы расчета контрольной суммы CRC16-CCITT. Все алгоритмы дают
+ * одинаковый результат и отличаются только скоростью и занимаемой памятью:
+ *
+ *      - BITWISE: побитовый расчет, таблицы не требуются;
+ *
+ *      - TABLE: таблица на 256 элементов (512 байт);
+ *
+ *      - SLICE_BY_4: 4 таблицы на 256 элементов (2 КБайт);
+ *
+ *      - SLICE_BY_8: 8 таблиц на 256 элементов (4 КБайт).
+ */
+#define rmpCRC_ENGINE_BITWISE    (0)
+#define rmpCRC_ENGINE_TABLE      (1)
+#define rmpCRC_ENGINE_SLICE_BY_4 (2)
+#define rmpCRC_ENGINE_SLICE_BY_8 (3)
+
+#ifndef rmpCRC_ENGINE
+    #define rmpCRC_ENGINE rmpCRC_ENGINE_TABLE
+#endif
+
+/**
+ * @brief Разрешает расчет CRC16-CCITT с помощью инструкции PCLMULQDQ (только
+ * x86-64). Наличие инструкции проверяется во время выполнения, при ее
+ * отсутствии используется алгоритм <rmpCRC_ENGINE>.
+ */
+#ifndef rmpCRC_CLMUL_ENABLE
+    #define rmpCRC_CLMUL_ENABLE (0)
+#endif
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Реализации конечного автомата обработчика сообщений. Обе реализации
+ * дают одинаковый результат и отличаются только способом перехода между
+ * состояниями:
+ *
+ *      - TABLE: вызов функции состояния через таблицу указателей объекта;
+ *
+ *      - SWITCH: функции состояний встроены в один цикл с выбором состояния
+ *        оператором switch (без косвенных вызовов).
+ */
+#define rmpSTATE_ENGINE_TABLE  (0)
+#define rmpSTATE_ENGINE_SWITCH (1)
+
+#ifndef rmpSTATE_ENGINE
+    #define rmpSTATE_ENGINE rmpSTATE_ENGINE_TABLE
+#endif
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Разрешает векторный (SSE2/AVX2) поиск пары байт начала сообщения.
+ * По умолчанию включено для x86-64, на остальных платформах используется
+ * скалярный поиск.
+ */
+#ifndef rmpSYNC_SCAN_SIMD_ENABLE
+    #if defined(__x86_64__) && defined(__GNUC__)
+        #define rmpSYNC_SCAN_SIMD_ENABLE (1)
+    #else
+        #define rmpSYNC_SCAN_SIMD_ENABLE (0)
+    #endif
+#endif
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Разрешает сбор статистики работы обработчика сообщений (см.
+ * <rmp_stats_t>). При выключенной статистике счетчики не компилируются.
+ */
+#ifndef rmpSTATS_ENABLE
+    #define rmpSTATS_ENABLE (0)
+#endif
+
+/**
+ * @brief Разрешает измерение задержки от записи байт сообщения в кольцевой
+ * буфер до передачи сообщения пользовательскому коду (см.
+ * RMP_GetLatencyPercentile()). При выключенном измерении метки времени и
+ * гистограммы не компилируются.
+ */
+#ifndef rmpLATENCY_ENABLE
+    #define rmpLATENCY_ENABLE (0)
+#endif
+
+/**
+ * @brief Разрешает определение времени поступления первого байта начала
+ * полученного сообщения (см. ProcessingEx() и RMP_GetFrameRxTimestamp()).
+ * При выключенном режиме метки времени не компилируются.
+ */
+#ifndef rmpRX_TIMESTAMP_ENABLE
+    #define rmpRX_TIMESTAMP_ENABLE (0)
+#endif
+
+/**
+ * @brief Разрешает ожидание сообщения без опроса (см. RMP_WaitForFrame()):
+ * поток обработки блокируется на eventfd, а Put() пробуждает его, когда в
+ * кольцевой буфер записано достаточно байт для получения сообщения. Только
+ * Linux.
+ */
+#ifndef rmpNOTIFY_ENABLE
+    #define rmpNOTIFY_ENABLE (0)
+#endif
+
+/**
+ * @brief Значение тайм-аута RMP_WaitForFrame() без ограничения времени
+ * ожидания.
+ */
+#define rmpNOTIFY_WAIT_FOREVER (UINT32_MAX)
+
+/**
+ * @brief Метки времени записи используются измерением задержки и
+ * определением времени поступления сообщения.
+ */
+#if (rmpLATENCY_ENABLE == 1) || (rmpRX_TIMESTAMP_ENABLE == 1)
+    #define rmpTIMESTAMP_MARKS_ENABLE (1)
+#else
+    #define rmpTIMESTAMP_MARKS_ENABLE (0)
+#endif
+
+/**
+ * @brief Количество меток времени записи, ожидающих обработки (степень 2).
+ * Если очередь заполнена, то метка не сохраняется и байты блока относятся к
+ * следующей метке (задержка занижается, время поступления завышается).
+ */
+#ifndef rmpTIMESTAMP_MARKS_NUMB
+    #define rmpTIMESTAMP_MARKS_NUMB (32u)
+#endif
+
+/**
+ * @brief Количество бит точности гистограммы задержки: интервал значений
+ * [2^k, 2^(k+1)) делится на 2^(rmpLATENCY_HIST_SUB_BUCKET_BITS - 1)
+ * интервалов, поэтому относительная погрешность не превышает
+ * 2^(1 - rmpLATENCY_HIST_SUB_BUCKET_BITS).
+ */
+#ifndef rmpLATENCY_HIST_SUB_BUCKET_BITS
+    #define rmpLATENCY_HIST_SUB_BUCKET_BITS (4u)
+#endif
+
+/**
+ * @brief Разрядность максимального значения задержки. Большие значения
+ * учитываются в последнем интервале гистограммы.
+ */
+#ifndef rmpLATENCY_HIST_MAX_BITS
+    #define rmpLATENCY_HIST_MAX_BITS (40u)
+#endif
+
+/**
+ * @brief Количество интервалов гистограммы задержки.
+ */
+#define rmpLATENCY_HIST_BUCKETS_NUMB                                           \
+    ((rmpLATENCY_HIST_MAX_BITS - rmpLATENCY_HIST_SUB_BUCKET_BITS + 2u)         \
+     << (rmpLATENCY_HIST_SUB_BUCKET_BITS - 1u))
+
+/**
+ * @brief Реализации кольцевого буфера обработчика сообщений (см.
+ * radio_message_parser_ring.h). Реализации совместимы по поведению (буфер
+ * размером N байт вмещает N - 1 байт) и отличаются размещением позиций чтения
+ * и записи в памяти и способом перехода через границу буфера:
+ *
+ *      - LWRB: библиотека lwrb, позиции чтения и записи расположены рядом;
+ *
+ *      - SPSC: позиции чтения и записи расположены в разных строках кэша, а
+ *        каждая сторона хранит копию позиции другой стороны и обновляет ее
+ *        только при нехватке данных (свободного места). Предназначена для
+ *        вызова Put() и Processing() из разных потоков (ядер);
+ *
+ *      - POW2: размер буфера должен быть степенью 2. Позиции чтения и записи
+ *        только увеличиваются (переполнение счетчиков допустимо), количество
+ *        байт в буфере равно их разности, а смещение в памяти вычисляется
+ *        маской, без сравнений и условного вычитания.
+ *
+ * Для SPSC и POW2 Reset() отбрасывает записанные байты без изменения позиции
+ * записи и может вызываться из потока потребителя. Политики переполнения,
+ * отличные от <rmpOVERFLOW_POLICY_REJECT_NEWEST>, удаляют байты в Put(),
+ * поэтому для SPSC и POW2 RMP_Ctor() с такой политикой возвращает NULL.
+ */
+#define rmpRING_BACKEND_LWRB (0)
+#define rmpRING_BACKEND_SPSC (1)
+#define rmpRING_BACKEND_POW2 (2)
+
+#ifndef rmpRING_BACKEND
+    #define rmpRING_BACKEND rmpRING_BACKEND_LWRB
+#endif
+
+/**
+ * @brief Размер строки кэша, на который разделяются поля производителя и
+ * потребителя кольцевого буфера <rmpRING_BACKEND_SPSC>.
+ */
+#ifndef rmpCACHE_LINE_SIZE
+    #define rmpCACHE_LINE_SIZE (64u)
+#endif
+
+#if (rmpSTATS_ENABLE == 1) || (rmpTIMESTAMP_MARKS_ENABLE == 1)                 \
+    || (rmpRING_BACKEND != rmpRING_BACKEND_LWRB) || (rmpNOTIFY_ENABLE == 1)
+    #include <stdatomic.h>
+#endif
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Разрешает функции выделения зеркальной области памяти кольцевого
+ * буфера RMP_MirrorMemAlloc() и RMP_MirrorMemFree(). По умолчанию включено для
+ * Linux (используются memfd_create() и mmap()).
+ */
+#ifndef rmpMIRROR_MEM_ENABLE
+    #if defined(__linux__)
+        #define rmpMIRROR_MEM_ENABLE (1)
+    #else
+        #define rmpMIRROR_MEM_ENABLE (0)
+    #endif
+#endif
 /*----------------------------------------------------------------------------*/
 
 typedef struct __rmpPACKED
@@ -224,10 +449,80 @@ typedef struct __rmpPACKED
     uint16_t uCrc;
 } rmp_package_generic_t;
 
+/**
+ * @brief Описание формата сообщения. Сообщение начинается с пары байт начала
+ * сообщения, контрольная сумма CRC16-CCITT (2 байта в порядке байт платформы,
+ * как поле <uCrc> в <rmp_package_generic_t>) рассчитывается по непрерывной
+ * области сообщения.
+ *
+ * Сообщение переменной длины (<bIsLengthPrefixed>) имеет вид:
+ * <байты начала сообщения (2)> <длина полезной нагрузки N (1)>
+ * <полезная нагрузка (N)> <контрольная сумма (2)>.
+ */
+typedef struct
+{
+    /**
+     * @brief Первый и второй байты начала сообщения.
+     */
+    uint8_t uSyncFirstByte;
+    uint8_t uSyncSecondByte;
+
+    /**
+     * @brief Размер сообщения в байтах, включая байты начала сообщения и
+     * контрольную сумму (не более <rmpFRAME_MAX_SIZE_IN_BYTES>).
+     */
+    size_t uFrameSizeInBytes;
+
+    /**
+     * @brief Смещение контрольной суммы от начала сообщения.
+     */
+    size_t uCrcOffset;
+
+    /**
+     * @brief Смещение и размер области сообщения, по которой рассчитывается
+     * контрольная сумма.
+     */
+    size_t uCrcCoverageOffset;
+    size_t uCrcCoverageSizeInBytes;
+
+    /**
+     * @brief Сообщение переменной длины. В этом режиме <uFrameSizeInBytes>
+     * задает максимальный размер сообщения, контрольная сумма расположена
+     * сразу за полезной нагрузкой и рассчитывается от <uCrcCoverageOffset> до
+     * контрольной суммы (<uCrcOffset> и <uCrcCoverageSizeInBytes> не
+     * используются).
+     */
+    bool bIsLengthPrefixed;
+
+    /**
+     * @brief Минимальная длина полезной нагрузки сообщения переменной длины.
+     * Сообщение с меньшей или превышающей максимальный размер длиной
+     * считается ложным началом сообщения.
+     */
+    size_t uMinPayloadSizeInBytes;
+} rmp_frame_desc_t;
+
+/**
+ * @brief Формат сообщения по умолчанию (см. <rmp_package_generic_t>). Для
+ * данного формата обработчик использует вариант конечного автомата, в котором
+ * формат сообщения известен во время компиляции.
+ */
+#define rmpFRAME_DESC_DEFAULT                                                  \
+    {                                                                          \
+        .uSyncFirstByte          = rmpSTART_FRAME_FIRST_BYTE,                  \
+        .uSyncSecondByte         = rmpSTART_FRAME_SECOND_BYTE,                 \
+        .uFrameSizeInBytes       = sizeof(rmp_package_generic_t),              \
+        .uCrcOffset              = offsetof(rmp_package_generic_t, uCrc),      \
+        .uCrcCoverageOffset      = offsetof(rmp_package_generic_t, xPLoad),    \
+        .uCrcCoverageSizeInBytes =                                             \
+            sizeof(((rmp_package_generic_t *) 0)->xPLoad),                     \
+    }
+
 typedef enum
 {
     rmpSTATE_FIND_FIRST_BYTE = 0,
     rmpSTATE_FIND_SECOND_BYTE,
+    rmpSTATE_READ_LENGTH,
     rmpSTATE_WAIT_AND_COPY_MESSAGE,
 
     rmpSTATE_MAX_NUMB,
@@ -252,7 +547,153 @@ typedef enum
      * @brief Данный код возврата обеспечивает выход из цикла в Processing().
      */
     rmpBREAK,
+
+    /**
+     * @brief Сообщение скопировано, но его контрольная сумма недостоверна.
+     * Processing() завершает обработку, ProcessingBatch() продолжает поиск
+     * следующего сообщения.
+     */
+    rmpCRC_ERROR,
 } rmp_return_code;
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Причина завершения последнего вызова Processing() или
+ * ProcessingBatch().
+ */
+typedef enum
+{
+    /**
+     * @brief В кольцевом буфере нет байт, которые могут быть обработаны до
+     * записи новых данных.
+     */
+    rmpSTOP_REASON_NO_DATA = 0,
+
+    /**
+     * @brief Исчерпано количество байт, которое разрешено считать за вызов.
+     * В кольцевом буфере остались необработанные байты.
+     */
+    rmpSTOP_REASON_BYTES_BUDGET,
+
+    /**
+     * @brief Исчерпано количество сообщений, которое разрешено извлечь за
+     * вызов (одно сообщение для Processing(), в том числе с недостоверной
+     * контрольной суммой). В кольцевом буфере могут остаться необработанные
+     * байты.
+     */
+    rmpSTOP_REASON_FRAMES_BUDGET,
+} rmp_stop_reason_e;
+
+/**
+ * @brief Поведение Put() и PutISR() при недостаточном количестве свободного
+ * места в кольцевом буфере.
+ */
+typedef enum
+{
+    /**
+     * @brief Записываются только байты, для которых есть свободное место,
+     * остальные (самые новые) байты отбрасываются.
+     */
+    rmpOVERFLOW_POLICY_REJECT_NEWEST = 0,
+
+    /**
+     * @brief Самые старые байты кольцевого буфера перезаписываются новыми
+     * (см. lwrb_overwrite()).
+     */
+    rmpOVERFLOW_POLICY_OVERWRITE_OLDEST,
+
+    /**
+     * @brief Из начала кольцевого буфера отбрасываются сообщения целиком (до
+     * очередной пары байт начала сообщения), пока не освободится место для
+     * новых байт.
+     */
+    rmpOVERFLOW_POLICY_DROP_OLDEST_FRAMES,
+
+    rmpOVERFLOW_POLICY_MAX_NUMB,
+} rmp_overflow_policy_e;
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Количество типов сообщений, различаемых по байту типа (см.
+ * <rmp_init_t>). Определяет размер таблицы обработчиков.
+ */
+#define rmpDISPATCH_TYPES_NUMB (256)
+
+/**
+ * @brief Пользовательский обработчик сообщения определенного типа (см.
+ * RMP_SetFrameHandler()).
+ *
+ * @param[in] pvCtx: Пользовательский контекст, указанный при регистрации
+ * обработчика.
+ *
+ * @param[in] pvFrame: Указатель на сообщение с достоверной контрольной суммой.
+ * Сообщение расположено непосредственно в памяти кольцевого буфера (или во
+ * внутреннем буфере, если оно разделено точкой перехода через границу
+ * кольцевого буфера) и доступно только до возврата из обработчика.
+ *
+ * @param[in] uFrameSizeInBytes: Размер сообщения в байтах.
+ */
+typedef void (*rmp_frame_handler_t)(
+    void       *pvCtx,
+    const void *pvFrame,
+    size_t      uFrameSizeInBytes);
+
+/**
+ * @brief Элемент таблицы обработчиков сообщений, индекс элемента равен
+ * значению байта типа сообщения.
+ */
+typedef struct
+{
+    rmp_frame_handler_t pfnHandler;
+    void               *pvCtx;
+} rmp_dispatch_entry_t;
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Пользовательская функция получения монотонной метки времени (см.
+ * <rmp_init_t>). Единица измерения задается пользователем, в ней же
+ * возвращаются значения задержки и время поступления сообщения.
+ */
+typedef uint64_t (*rmp_timestamp_fn_t)(void);
+
+/**
+ * @brief Сведения о полученном сообщении (см. ProcessingEx()).
+ */
+typedef struct
+{
+    /**
+     * @brief Размер сообщения в байтах.
+     */
+    size_t uFrameSizeInBytes;
+
+    /**
+     * @brief Время поступления первого байта начала сообщения (см.
+     * <rmpRX_TIMESTAMP_ENABLE>). Действительно, если установлен флаг
+     * <bIsRxTimestampValid>.
+     */
+    uint64_t uRxTimestamp;
+    bool     bIsRxTimestampValid;
+} rmp_frame_info_t;
+
+/**
+ * @brief Измеряемые задержки сообщения (см. RMP_GetLatencyPercentile()).
+ */
+typedef enum
+{
+    /**
+     * @brief От записи первого байта сообщения в кольцевой буфер до передачи
+     * сообщения пользовательскому коду.
+     */
+    rmpLATENCY_FIRST_BYTE = 0,
+
+    /**
+     * @brief От записи последнего байта сообщения в кольцевой буфер до
+     * передачи сообщения пользовательскому коду.
+     */
+    rmpLATENCY_LAST_BYTE,
+
+    rmpLATENCY_MAX_NUMB,
+} rmp_latency_e;
 
 /**
  * @brief Набор API, предоставляемый библиотекой пользовательскому коду.
@@ -261,7 +702,8 @@ typedef struct
 {
     /**
      * @brief Запись байт в кольцевой буфер для последующей обработки при вызове
-     * Processing()
+     * Processing(). При недостаточном количестве свободного места поведение
+     * определяется <eOverflowPolicy> (см. <rmp_init_t>).
      *
      * @param[out] vObj: Указатель на объект обработчика сообщений.
      *
@@ -278,6 +720,39 @@ typedef struct
 
     size_t (*PutISR)(void *vObj, void *pSrc, size_t uBytesNumb);
 
+    /**
+     * @brief Возвращает адрес и размер линейного блока свободной памяти
+     * кольцевого буфера. Блок может быть заполнен напрямую (например, DMA или
+     * read(2)) без промежуточного копирования, после чего количество
+     * записанных байт передается в CommitWrite().
+     *
+     * @param[out] vObj: Указатель на объект обработчика сообщений.
+     *
+     * @param[out] puSpanLen: Размер линейного блока в байтах. Если свободное
+     * место расположено по обе стороны от границы буфера, то возвращается блок
+     * до границы, следующий блок возвращается после вызова CommitWrite().
+     * Для зеркальной области памяти возвращается все свободное место. При
+     * реализации кольцевого буфера SPSC размер определяется по копии позиции
+     * чтения и уточняется, только если блок меньше сообщения.
+     *
+     * @return Адрес линейного блока или NULL, если в кольцевом буфере нет
+     * свободного места.
+     */
+    void *(*GetWriteSpan)(void *vObj, size_t *puSpanLen);
+
+    /**
+     * @brief Фиксирует запись байт в блок, полученный при вызове
+     * GetWriteSpan(). После вызова байты становятся доступны Processing().
+     *
+     * @param[out] vObj: Указатель на объект обработчика сообщений.
+     *
+     * @param[in] uBytesNumb: Количество записанных в блок байт.
+     *
+     * @return Количество зафиксированных байт (не превышает размер свободного
+     * места в кольцевом буфере).
+     */
+    size_t (*CommitWrite)(void *vObj, size_t uBytesNumb);
+
     /**
      * @brief Обработчик байт в кольцевом буфере. Если в процессе обработки
      * обнаружено сообщение, то оно будет записано по адресу, указанному в
@@ -293,7 +768,12 @@ typedef struct
      *
      * @return Возвращает размер записанного в <pDst> сообщения. Если функция
      * вернула <0>, то сообщение в кольцевом буфере не обнаружено (или размер
-     * области памяти <pDst> меньше <rmpONE_MESSAGE_SIZE_IN_BYTES>).
+     * области памяти <pDst> меньше размера сообщения, см.
+     * <rmp_frame_desc_t>).
+     *
+     * @note Количество байт, считываемых за вызов, ограничено значением
+     * <uReadBytesThreshold> (см. <rmp_init_t>). Причина завершения вызова
+     * возвращается RMP_GetStopReason().
      */
     size_t (*Processing)(void *vObj, void *pDst, size_t uDstMemSize);
 
@@ -306,55 +786,555 @@ typedef struct
      * @return Количество записанных байт в кольцевой буфер перед его сбросом.
      */
     size_t (*Reset)(void *vObj);
-} rmp_api_t;
-
-typedef rmp_api_t *rmp_api_handle_t;
-/*----------------------------------------------------------------------------*/
-
-typedef struct
-{
-    rmp_return_code (
-        *aFn[rmpSTATE_MAX_NUMB])(void *vObj, void *pDst, size_t uDstMemSize);
-} rmp_state_api_t;
-
-typedef rmp_state_api_t *rmp_state_api_handle_t;
-/*----------------------------------------------------------------------------*/
 
-typedef struct
-{
     /**
-     * @brief Область памяти хранения API функций.
+     * @brief Выполняет поиск сообщения с достоверной контрольной суммой без
+     * копирования в пользовательскую область памяти.
      *
-     * @warning Данное поле должно быть расположено в начале структуры данных, в
-     * этом случае адрес переменной типа <rmp_obj_t> совпадает с адресом
-     * переменной типа <rmp_api_t>.
+     * Если сообщение целиком расположено в линейном блоке кольцевого буфера,
+     * то возвращается указатель непосредственно на память кольцевого буфера,
+     * контрольная сумма проверяется там же. Копирование во внутренний буфер
+     * выполняется только для сообщений, разделенных точкой перехода через
+     * границу кольцевого буфера. Байты сообщения с недостоверной контрольной
+     * суммой отбрасываются так же, как в Processing() (см.
+     * <bIsResyncOnCrcError>).
+     *
+     * @warning Сообщение остается в кольцевом буфере до вызова ReleaseFrame(),
+     * поэтому до этого момента вызовы Processing() и Reset() недопустимы.
+     * Повторный вызов AcquireFrame() без ReleaseFrame() возвращает то же
+     * сообщение.
+     *
+     * @param[out] vObj: Указатель на объект обработчика сообщений.
+     *
+     * @return Указатель на сообщение или NULL, если сообщение в кольцевом
+     * буфере не обнаружено. Размер сообщения совпадает со значением, которое
+     * вернул бы Processing(): <uFrameSizeInBytes> формата сообщения (см.
+     * <rmp_frame_desc_t>), а для сообщения переменной длины определяется
+     * байтом длины (см. RMP_GetLengthPrefixedFrameDesc()).
      */
-    rmp_api_t xAPI;
-
-    rmp_state_api_t xStateAPI;
+    const void *(*AcquireFrame)(void *vObj);
 
     /**
-     * @brief Текущее состояние конечного автомата.
+     * @brief Освобождает сообщение, полученное при вызове AcquireFrame(), и
+     * занимаемое им место в кольцевом буфере.
+     *
+     * @param[out] vObj: Указатель на объект обработчика сообщений.
      */
-    rmp_state_e eState;
+    void (*ReleaseFrame)(void *vObj);
 
     /**
-     * @brief Управляющая структура кольцевого буфера.
+     * @brief Обработчик байт в кольцевом буфере, извлекающий за один вызов все
+     * полностью записанные в буфер сообщения с достоверной контрольной суммой.
+     * В отличие от Processing(), сообщение с недостоверной контрольной суммой
+     * не прерывает обработку.
+     *
+     * @param[out] vObj: Указатель на объект обработчика сообщений.
+     *
+     * @param[out] pFrames: Массив для записи найденных сообщений. Сообщения
+     * записываются друг за другом с шагом, равным размеру сообщения (для
+     * сообщений переменной длины - максимальному размеру сообщения, см.
+     * <rmp_frame_desc_t>).
+     *
+     * @param[in] uMaxFramesNumb: Количество сообщений, которое может быть
+     * записано в <pFrames>.
+     *
+     * @param[in] uBudget: Максимальное количество байт, считываемых из
+     * кольцевого буфера за один вызов (0 - без ограничения). Сообщение всегда
+     * считывается целиком, поэтому ограничение может быть превышено менее чем
+     * на размер одного сообщения.
+     *
+     * @param[out] puConsumedBytesNumb: Количество байт, считанных из кольцевого
+     * буфера за вызов (может быть NULL).
+     *
+     * @return Количество сообщений, записанных в <pFrames>. Причина
+     * завершения вызова возвращается RMP_GetStopReason().
      */
-    lwrb_t xLWRB;
-    /*------------------------------------------------------------------------*/
+    size_t (*ProcessingBatch)(
+        void                  *vObj,
+        void   *pFrames,
+        size_t  uMaxFramesNumb,
+        size_t  uBudget,
+        size_t *puConsumedBytesNumb);
 
     /**
-     * @brief Количество считанных из буфера байт перед принудительным
-     * прерыванием цикла поиска начала сообщения.
+     * @brief Передает найденные сообщения с достоверной контрольной суммой
+     * обработчикам, зарегистрированным для их типа (см.
+     * RMP_SetFrameHandler()). Поиск сообщений выполняется так же, как в
+     * AcquireFrame(), поэтому сообщение передается обработчику без
+     * копирования.
+     *
+     * Сообщение, для типа которого обработчик не зарегистрирован,
+     * отбрасывается. Если установлен флаг <bIsDropUnregisteredTypes> (см.
+     * <rmp_init_t>), то такое сообщение отбрасывается до проверки контрольной
+     * суммы.
+     *
+     * @warning Обработчик не должен вызывать функции API того же объекта.
+     *
+     * @param[out] vObj: Указатель на объект обработчика сообщений.
+     *
+     * @param[in] uMaxFramesNumb: Максимальное количество сообщений,
+     * передаваемых обработчикам за вызов (0 - без ограничения).
+     *
+     * @return Количество сообщений, переданных обработчикам (0, если таблица
+     * обработчиков не задана). Причина завершения вызова возвращается
+     * RMP_GetStopReason().
      */
-    size_t uReadBytesThreshold;
-} rmp_obj_t;
+    size_t (*Dispatch)(void *vObj, size_t uMaxFramesNumb);
 
-typedef rmp_obj_t *rmp_data_handle_t;
-/*----------------------------------------------------------------------------*/
-
-/**
+    /**
+     * @brief Processing(), дополнительно возвращающий сведения о полученном
+     * сообщении, в том числе время поступления первого байта начала
+     * сообщения (см. <rmpRX_TIMESTAMP_ENABLE>).
+     *
+     * @param[out] vObj: Указатель на объект обработчика сообщений.
+     * @param[out] pDst: Указатель на область памяти для записи сообщения.
+     * @param[in] uDstMemSize: Размер области памяти <pDst>.
+     * @param[out] pxInfo: Сведения о сообщении (заполняются, если сообщение
+     * получено; может быть NULL).
+     *
+     * @return Аналогично Processing().
+     */
+    size_t (*ProcessingEx)(
+        void             *vObj,
+        void             *pDst,
+        size_t            uDstMemSize,
+        rmp_frame_info_t *pxInfo);
+} rmp_api_t;
+
+typedef rmp_api_t *rmp_api_handle_t;
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Статистика работы обработчика сообщений, полученная при вызове
+ * RMP_GetStatsAndReset().
+ */
+typedef struct
+{
+    /**
+     * @brief Количество байт, записанных в кольцевой буфер Put(), PutISR() и
+     * CommitWrite().
+     */
+    size_t uIngestedBytesNumb;
+
+    /**
+     * @brief Количество байт, не записанных в кольцевой буфер Put(), PutISR()
+     * и CommitWrite() из-за отсутствия свободного места.
+     */
+    size_t uRejectedBytesNumb;
+
+    /**
+     * @brief Количество необработанных байт, удаленных из кольцевого буфера
+     * для записи новых байт (политики <rmpOVERFLOW_POLICY_OVERWRITE_OLDEST> и
+     * <rmpOVERFLOW_POLICY_DROP_OLDEST_FRAMES>).
+     */
+    size_t uDiscardedBytesNumb;
+
+    /**
+     * @brief Количество сообщений (в том числе частично обработанных),
+     * удаленных из кольцевого буфера политикой
+     * <rmpOVERFLOW_POLICY_DROP_OLDEST_FRAMES>.
+     */
+    size_t uDroppedFramesNumb;
+
+    /**
+     * @brief Количество байт, отброшенных при поиске начала сообщения.
+     */
+    size_t uSkippedBytesNumb;
+
+    /**
+     * @brief Количество первых байт начала сообщения, за которыми не следует
+     * второй байт начала сообщения (учитываются только байты, обнаруженные на
+     * границе линейного блока кольцевого буфера, т.к. внутри блока пара байт
+     * ищется целиком).
+     */
+    size_t uFalseFirstByteNumb;
+
+    /**
+     * @brief Количество сообщений с недостоверной контрольной суммой.
+     */
+    size_t uCrcErrorsNumb;
+
+    /**
+     * @brief Количество сообщений переменной длины с недопустимой длиной.
+     */
+    size_t uLengthErrorsNumb;
+
+    /**
+     * @brief Количество сообщений с достоверной контрольной суммой, переданных
+     * пользовательскому коду.
+     */
+    size_t uDeliveredFramesNumb;
+
+    /**
+     * @brief Количество сообщений, отброшенных Dispatch() и AcquireFrame()
+     * из-за отсутствия обработчика для их типа.
+     */
+    size_t uUnhandledFramesNumb;
+
+    /**
+     * @brief Количество вызовов Reset().
+     */
+    size_t uResetsNumb;
+} rmp_stats_t;
+
+#if (rmpSTATS_ENABLE == 1)
+/**
+ * @brief Счетчики статистики. Изменяются обработчиком (в том числе из
+ * прерывания) без упорядочивания доступа к памяти и считываются
+ * RMP_GetStatsAndReset() из любого потока.
+ */
+typedef struct
+{
+    atomic_size_t uIngestedBytesNumb;
+    atomic_size_t uRejectedBytesNumb;
+    atomic_size_t uDiscardedBytesNumb;
+    atomic_size_t uDroppedFramesNumb;
+    atomic_size_t uSkippedBytesNumb;
+    atomic_size_t uFalseFirstByteNumb;
+    atomic_size_t uCrcErrorsNumb;
+    atomic_size_t uLengthErrorsNumb;
+    atomic_size_t uDeliveredFramesNumb;
+    atomic_size_t uUnhandledFramesNumb;
+    atomic_size_t uResetsNumb;
+} rmp_stats_cnt_t;
+#endif
+
+#if (rmpTIMESTAMP_MARKS_ENABLE == 1)
+/**
+ * @brief Метка времени записи: байты потока до позиции <uEndPos> (значение
+ * счетчика записанных байт после записи блока) записаны не позже момента
+ * <uTimestamp>.
+ */
+typedef struct
+{
+    size_t   uEndPos;
+    uint64_t uTimestamp;
+} rmp_timestamp_mark_t;
+#endif
+
+#if (rmpRING_BACKEND == rmpRING_BACKEND_SPSC)
+/**
+ * @brief Кольцевой буфер с разделением полей производителя (Put()) и
+ * потребителя (Processing()) по строкам кэша. Каждая сторона записывает только
+ * поля своей строки, поэтому запись байт не вытесняет строку потребителя из
+ * кэша другого ядра. Адрес и размер буфера продублированы в строке
+ * производителя, чтобы производитель не обращался к строке потребителя.
+ */
+typedef struct
+{
+    /* Поля потребителя */
+    uint8_t      *pBuff;
+    size_t        uSize;
+    atomic_size_t uR;
+    size_t        uCachedW;
+
+    uint8_t uaConsumerPad[rmpCACHE_LINE_SIZE];
+
+    /* Поля производителя */
+    uint8_t      *pProducerBuff;
+    size_t        uProducerSize;
+    atomic_size_t uW;
+    size_t        uCachedR;
+
+    uint8_t uaProducerPad[rmpCACHE_LINE_SIZE];
+} rmp_ring_t;
+#elif (rmpRING_BACKEND == rmpRING_BACKEND_POW2)
+/**
+ * @brief Кольцевой буфер размером 2^n байт со свободно увеличивающимися
+ * позициями чтения и записи.
+ */
+typedef struct
+{
+    uint8_t      *pBuff;
+    size_t        uMask;
+    atomic_size_t uR;
+    atomic_size_t uW;
+} rmp_ring_t;
+#else
+typedef lwrb_t rmp_ring_t;
+#endif
+
+#if (rmpLATENCY_ENABLE == 1)
+/**
+ * @brief Гистограмма задержки с логарифмически-линейными интервалами
+ * (HDR). Размер не зависит от количества измерений.
+ */
+typedef struct
+{
+    uint64_t uTotalCnt;
+    uint64_t uMin;
+    uint64_t uMax;
+    uint32_t uaCnt[rmpLATENCY_HIST_BUCKETS_NUMB];
+} rmp_latency_hist_t;
+#endif
+/*----------------------------------------------------------------------------*/
+
+typedef struct
+{
+    rmp_return_code (
+        *aFn[rmpSTATE_MAX_NUMB])(void *vObj, void *pDst, size_t uDstMemSize);
+} rmp_state_api_t;
+
+typedef const rmp_state_api_t *rmp_state_api_handle_t;
+/*----------------------------------------------------------------------------*/
+
+typedef struct
+{
+    /**
+     * @brief Область памяти хранения API функций.
+     *
+     * @warning Данное поле должно быть расположено в начале структуры данных, в
+     * этом случае адрес переменной типа <rmp_obj_t> совпадает с адресом
+     * переменной типа <rmp_api_t>.
+     */
+    rmp_api_t xAPI;
+
+    /* Поля, к которым обработчик обращается при каждом вызове, расположены
+     * подряд сразу после <xAPI> (88 байт, 11 указателей). Для объекта,
+     * выровненного на 64 байта, остаток строки кэша после <xAPI> (смещения
+     * 88-127 для x86-64) занимают таблица состояний, флаги, ограничение,
+     * размер сообщения и адрес области памяти кольцевого буфера, которые
+     * только читаются (размер сообщения переменной длины записывается один раз
+     * на сообщение). Все поля, изменяемые при каждом вызове: позиции чтения и
+     * записи кольцевого буфера, оставшееся и общее количество считанных байт,
+     * состояние конечного автомата и причина завершения вызова - расположены
+     * в следующей строке (смещения 128-191 для <rmpRING_BACKEND_LWRB> и
+     * <rmpRING_BACKEND_POW2>). Для <rmpRING_BACKEND_SPSC> поля производителя
+     * и потребителя кольцевого буфера разделены заполнением */
+
+    /**
+     * @brief Таблица функций состояний конечного автомата. Таблицы являются
+     * константами, общими для всех экземпляров, вариант таблицы выбирается в
+     * RMP_Ctor() по формату сообщения.
+     */
+    const rmp_state_api_t *pxStateAPI;
+
+    /**
+     * @brief Состояние, в которое выполняется переход после обнаружения пары
+     * байт начала сообщения (выбирается в RMP_Ctor() по формату сообщения).
+     */
+    rmp_state_e eSyncNextState;
+
+    /**
+     * @brief Режим восстановления синхронизации при недостоверной контрольной
+     * сумме (см. <rmp_init_t>).
+     */
+    bool bIsResyncOnCrcError;
+
+    /**
+     * @brief Кольцевой буфер размещен в зеркальной области памяти (см.
+     * <rmp_init_t>).
+     */
+    bool bIsMirroredMem;
+
+    /**
+     * @brief Объединенная обработка сообщений, целиком записанных в буфер
+     * (см. <rmp_init_t>).
+     */
+    bool bIsFastPathEnabled;
+
+    /**
+     * @brief Формат сообщения совпадает с форматом по умолчанию (определяется
+     * в RMP_InitStateAPI()).
+     */
+    bool bIsDefaultFrameDesc;
+
+    /**
+     * @brief Количество байт, которое разрешено считать из кольцевого буфера
+     * за один вызов Processing() (0 - без ограничения).
+     */
+    size_t uReadBytesThreshold;
+
+    /**
+     * @brief Размер текущего или последнего полученного сообщения (для
+     * сообщения переменной длины определяется байтом длины).
+     */
+    size_t uFrameSizeInBytes;
+    /*------------------------------------------------------------------------*/
+
+    /**
+     * @brief Управляющая структура кольцевого буфера (см.
+     * <rmpRING_BACKEND>).
+     */
+    rmp_ring_t xRing;
+
+    /**
+     * @brief Количество байт, которое еще разрешено считать из кольцевого
+     * буфера в текущем вызове обработчика.
+     */
+    size_t uReadBytesLeft;
+
+    /**
+     * @brief Общее количество считанных из кольцевого буфера байт (счетчик
+     * переполняется и используется для вычисления разности значений).
+     */
+    size_t uReadBytesCnt;
+
+    /**
+     * @brief Текущее состояние конечного автомата.
+     */
+    rmp_state_e eState;
+
+    /**
+     * @brief Причина завершения последнего вызова обработчика.
+     */
+    rmp_stop_reason_e eStopReason;
+    /*------------------------------------------------------------------------*/
+
+    /**
+     * @brief Поведение Put() при переполнении кольцевого буфера (см.
+     * <rmp_init_t>).
+     */
+    rmp_overflow_policy_e eOverflowPolicy;
+
+    /**
+     * @brief Формат сообщения (см. <rmp_init_t>).
+     */
+    rmp_frame_desc_t xFrameDesc;
+
+    /**
+     * @brief Таблица обработчиков сообщений, смещение байта типа сообщения и
+     * режим отбрасывания сообщений без обработчика (см. <rmp_init_t>).
+     */
+    rmp_dispatch_entry_t *pxDispatchTable;
+    size_t                uDispatchTypeOffset;
+    bool                  bIsDropUnregisteredTypes;
+    /*------------------------------------------------------------------------*/
+
+    /**
+     * @brief Сообщение, полученное при вызове AcquireFrame() (NULL, если
+     * сообщение не получено или уже освобождено).
+     */
+    const void *pAcquiredFrame;
+
+    /**
+     * @brief Количество байт, освобождаемых в кольцевом буфере при вызове
+     * ReleaseFrame().
+     */
+    size_t uAcquiredBytesNumb;
+
+    /**
+     * @brief Копия сообщения, разделенного точкой перехода через границу
+     * кольцевого буфера.
+     */
+    uint8_t uaStaging[rmpFRAME_MAX_SIZE_IN_BYTES];
+
+#if (rmpSTATS_ENABLE == 1)
+    /**
+     * @brief Счетчики статистики работы обработчика сообщений.
+     */
+    rmp_stats_cnt_t xStats;
+#endif
+
+#if (rmpTIMESTAMP_MARKS_ENABLE == 1)
+    /**
+     * @brief Функция получения метки времени (NULL - метки не сохраняются) и
+     * длительность передачи одного байта (см. <rmp_init_t>).
+     */
+    rmp_timestamp_fn_t pfnGetTimestamp;
+    uint64_t           uByteDuration;
+
+    /**
+     * @brief Общее количество записанных в кольцевой буфер байт (счетчик
+     * переполняется, как и <uReadBytesCnt>). Изменяется только при записи.
+     */
+    size_t uWriteBytesCnt;
+
+    /**
+     * @brief Очередь меток времени записи: <uMarksHead> изменяется при записи,
+     * <uMarksTail> - при обработке байт.
+     */
+    rmp_timestamp_mark_t xaMarks[rmpTIMESTAMP_MARKS_NUMB];
+    atomic_size_t        uMarksHead;
+    atomic_size_t        uMarksTail;
+#endif
+
+#if (rmpRX_TIMESTAMP_ENABLE == 1)
+    /**
+     * @brief Последняя освобожденная метка (граница блока, предшествующего
+     * первой метке очереди).
+     */
+    rmp_timestamp_mark_t xPrevMark;
+    bool                 bIsPrevMarkValid;
+
+    /**
+     * @brief Время поступления первого байта последнего полученного
+     * сообщения.
+     */
+    uint64_t uFrameRxTimestamp;
+    bool     bIsFrameRxTimestampValid;
+#endif
+
+#if (rmpLATENCY_ENABLE == 1)
+    /**
+     * @brief Гистограммы задержки (см. <rmp_latency_e>).
+     */
+    rmp_latency_hist_t xaLatencyHist[rmpLATENCY_MAX_NUMB];
+#endif
+
+#if (rmpNOTIFY_ENABLE == 1)
+    /**
+     * @brief Дескриптор eventfd пробуждения потока обработки (-1, если не
+     * создан) и минимальный размер сообщения.
+     */
+    int    iNotifyFd;
+    size_t uNotifyMinFrameSize;
+
+    /**
+     * @brief Общее количество записанных байт (счетчик переполняется).
+     * Изменяется только при записи.
+     */
+    atomic_size_t uNotifyWriteCnt;
+
+    /**
+     * @brief Значение счетчика записанных байт, при котором поток обработки
+     * пробуждается, если ожидание разрешено <bIsNotifyArmed>.
+     */
+    atomic_size_t uNotifyTarget;
+    atomic_bool   bIsNotifyArmed;
+#endif
+} rmp_obj_t;
+
+typedef rmp_obj_t *rmp_data_handle_t;
+
+#if (rmpSTATS_ENABLE == 1)
+    #define rmpSTATS_ADD(hObj, uCnt, uValue)                                   \
+        ((void) atomic_fetch_add_explicit(                                     \
+            &(hObj)->xStats.uCnt,                                              \
+            (size_t) (uValue),                                                 \
+            memory_order_relaxed))
+    #define rmpSTATS_SUB(hObj, uCnt, uValue)                                   \
+        ((void) atomic_fetch_sub_explicit(                                     \
+            &(hObj)->xStats.uCnt,                                              \
+            (size_t) (uValue),                                                 \
+            memory_order_relaxed))
+#else
+    #define rmpSTATS_ADD(hObj, uCnt, uValue) ((void) 0)
+    #define rmpSTATS_SUB(hObj, uCnt, uValue) ((void) 0)
+#endif
+
+#if (rmpNOTIFY_ENABLE == 1)
+    #define rmpNOTIFY_WRITE(hObj, uWrittenBytesNumb)                           \
+        RMP_NotifyWrite((hObj), (uWrittenBytesNumb))
+#else
+    #define rmpNOTIFY_WRITE(hObj, uWrittenBytesNumb) ((void) 0)
+#endif
+
+#if (rmpTIMESTAMP_MARKS_ENABLE == 1)
+    #define rmpTIMESTAMP_MARK(hObj, uWrittenBytesNumb)                         \
+        RMP_TimestampMark((hObj), (uWrittenBytesNumb))
+    #define rmpTIMESTAMP_RELEASE(hObj) RMP_TimestampRelease((hObj))
+    #define rmpTIMESTAMP_FRAME(hObj, uFrameStartPos, uFrameSizeInBytes)       \
+        RMP_TimestampFrame((hObj), (uFrameStartPos), (uFrameSizeInBytes))
+#else
+    #define rmpTIMESTAMP_MARK(hObj, uWrittenBytesNumb) ((void) 0)
+    #define rmpTIMESTAMP_RELEASE(hObj)                 ((void) 0)
+    #define rmpTIMESTAMP_FRAME(hObj, uFrameStartPos, uFrameSizeInBytes)       \
+        ((void) 0)
+#endif
+/*----------------------------------------------------------------------------*/
+
+/**
  * @brief
  */
 typedef struct
@@ -391,10 +1371,145 @@ typedef struct
     rmp_data_handle_t hData;
 
     /**
-     * @brief Количество считанных из буфера байт перед принудительным
-     * прерыванием цикла поиска начала сообщения.
+     * @brief Количество байт, которое разрешено считать из кольцевого буфера
+     * за один вызов Processing() во всех состояниях конечного автомата
+     * (0 - без ограничения). Сообщение всегда считывается целиком, поэтому
+     * ограничение может быть превышено менее чем на размер одного сообщения.
+     *
+     * Ограничение задает максимальную длительность вызова Processing() при
+     * большом количестве байт в буфере, причина завершения вызова
+     * возвращается RMP_GetStopReason().
      */
     size_t uReadBytesThreshold;
+
+    /**
+     * @brief Режим восстановления синхронизации при недостоверной контрольной
+     * сумме.
+     *
+     * Если режим выключен, то при недостоверной контрольной сумме байты
+     * сообщения отбрасываются. Если в них находилось начало следующего
+     * сообщения, то оно также будет потеряно.
+     *
+     * Если режим включен, то байты сообщения считываются из кольцевого буфера
+     * только при достоверной контрольной сумме, иначе поиск начала сообщения
+     * продолжается с байта, следующего за ложным началом сообщения.
+     */
+    bool bIsResyncOnCrcError;
+
+    /**
+     * @brief Область памяти <pMemAlloc> является зеркальной: за ней
+     * непосредственно следует отображение тех же страниц памяти размером
+     * <uMemAllocSizeInBytes> (см. RMP_MirrorMemAlloc()).
+     *
+     * В этом случае все непрочитанные байты кольцевого буфера расположены в
+     * памяти непрерывно, и сообщение никогда не разделяется точкой перехода
+     * через границу буфера. Поведение Put() и Processing() не изменяется.
+     *
+     * @warning Если флаг установлен для обычной области памяти, то
+     * обработчик выполнит чтение за ее пределами.
+     */
+    bool bIsMirroredMem;
+
+    /**
+     * @brief Объединенная обработка сообщения, целиком записанного в линейный
+     * блок кольцевого буфера (по умолчанию включена): поиск пары байт начала
+     * сообщения, проверка контрольной суммы и копирование выполняются в
+     * состоянии поиска первого байта за один вызов, без переходов конечного
+     * автомата. Конечный автомат используется только для сообщений, записанных
+     * в буфер не полностью или разделенных точкой перехода через границу
+     * буфера. Результат обработки не зависит от режима.
+     *
+     * Не используется для сообщений переменной длины.
+     */
+    bool bIsFastPathEnabled;
+
+    /**
+     * @brief Поведение Put() и PutISR() при недостаточном количестве
+     * свободного места в кольцевом буфере. По умолчанию
+     * <rmpOVERFLOW_POLICY_REJECT_NEWEST>.
+     *
+     * Политики <rmpOVERFLOW_POLICY_OVERWRITE_OLDEST> и
+     * <rmpOVERFLOW_POLICY_DROP_OLDEST_FRAMES> сохраняют самые новые данные:
+     * старые байты удаляются из буфера, а конечный автомат возвращается к
+     * поиску начала сообщения. Пока сообщение получено AcquireFrame() и не
+     * освобождено, используется <rmpOVERFLOW_POLICY_REJECT_NEWEST>.
+     * GetWriteSpan() и CommitWrite() не зависят от политики.
+     *
+     * @warning Данные политики изменяют позицию чтения кольцевого буфера,
+     * поэтому вызовы Put() и PutISR() не должны выполняться одновременно с
+     * обработкой байт (Processing() и др.). Для <rmpRING_BACKEND>, отличной
+     * от <rmpRING_BACKEND_LWRB>, RMP_Ctor() с такой политикой возвращает
+     * NULL.
+     */
+    rmp_overflow_policy_e eOverflowPolicy;
+
+    /**
+     * @brief Формат сообщения: байты начала сообщения, размер сообщения,
+     * расположение контрольной суммы и область ее расчета. По умолчанию
+     * <rmpFRAME_DESC_DEFAULT>.
+     *
+     * Вариант конечного автомата выбирается в RMP_Ctor(): для формата по
+     * умолчанию используется вариант, в котором формат известен во время
+     * компиляции, для остальных форматов - вариант, считывающий формат из
+     * <rmp_obj_t>. Формат проверяется один раз на сообщение, а не на байт.
+     */
+    rmp_frame_desc_t xFrameDesc;
+    /*------------------------------------------------------------------------*/
+
+    /**
+     * @brief Указатель на таблицу обработчиков сообщений из
+     * <rmpDISPATCH_TYPES_NUMB> элементов, используемую Dispatch() (NULL -
+     * таблица не используется). Таблица очищается в RMP_Ctor(), обработчики
+     * регистрируются RMP_SetFrameHandler().
+     *
+     * @note Данная область памяти выделяется пользователем, время ее жизни
+     * должно быть не меньше времени жизни экземпляра <radio_message_parser>.
+     */
+    rmp_dispatch_entry_t *pxDispatchTable;
+
+    /**
+     * @brief Смещение байта типа сообщения от начала сообщения. По умолчанию
+     * первый байт полезной нагрузки <rmp_package_generic_t>. Должно быть
+     * меньше минимального размера сообщения.
+     */
+    size_t uDispatchTypeOffset;
+
+    /**
+     * @brief Отбрасывать сообщения, для типа которых не зарегистрирован
+     * обработчик, до проверки контрольной суммы (в AcquireFrame() и
+     * Dispatch()).
+     *
+     * Сообщение отбрасывается целиком, поэтому если байты начала сообщения
+     * оказались ложными, то начало следующего сообщения в его пределах будет
+     * потеряно.
+     */
+    bool bIsDropUnregisteredTypes;
+    /*------------------------------------------------------------------------*/
+
+    /**
+     * @brief Функция получения монотонной метки времени для измерения
+     * задержки и определения времени поступления сообщений (NULL - метки
+     * времени не используются). Используется только при <rmpLATENCY_ENABLE>
+     * или <rmpRX_TIMESTAMP_ENABLE>.
+     *
+     * Функция вызывается Put(), PutISR() и CommitWrite() один раз на блок
+     * записи и обработчиком один раз на полученное сообщение, поэтому должна
+     * быть допустима в прерывании.
+     */
+    rmp_timestamp_fn_t pfnGetTimestamp;
+
+    /**
+     * @brief Длительность передачи одного байта в единицах
+     * <pfnGetTimestamp> (например, 10 бит / скорость UART).
+     *
+     * Время поступления байта определяется по метке блока записи, в котором
+     * он находится: байты блока поступают один за другим с интервалом
+     * <uByteDuration>, последний байт - в момент записи блока, но не раньше
+     * записи предыдущего блока. Если длительность равна 0, то время
+     * поступления линейно интерполируется между метками предыдущего и
+     * текущего блоков (поток без пауз).
+     */
+    uint64_t uByteDuration;
 } rmp_init_t;
 
 extern void
@@ -412,12 +1527,125 @@ RMP_SetState(void *vObj, rmp_state_e eNewState);
 extern rmp_state_e
 RMP_GetState(void *vObj);
 
+extern rmp_stop_reason_e
+RMP_GetStopReason(void *vObj);
+
+extern bool
+RMP_GetStatsAndReset(void *vObj, rmp_stats_t *pxStats);
+
+extern size_t
+RMP_Skip(void *vObj, size_t uBytesNumb);
+
+extern const uint8_t *
+RMP_GetReadSpan(void *vObj, size_t *puSpanLen);
+
+extern rmp_return_code
+RMP_RunStateMachine(void *vObj, void *pDst, size_t uDstMemSize);
+
+extern bool
+RMP_GetLatencyPercentile(
+    void         *vObj,
+    rmp_latency_e eLatency,
+    double        dPercentile,
+    uint64_t     *puValue);
+
+extern bool
+RMP_ResetLatency(void *vObj);
+
+extern bool
+RMP_GetFrameRxTimestamp(void *vObj, uint64_t *puRxTimestamp);
+
+extern bool
+RMP_WaitForFrame(void *vObj, uint32_t uTimeoutMs);
+
+extern bool
+RMP_ArmFrameNotify(void *vObj);
+
+extern int
+RMP_GetNotifyFd(void *vObj);
+
+#if (rmpNOTIFY_ENABLE == 1)
+extern bool
+RMP_NotifyInit(rmp_data_handle_t hObj, size_t uMinFrameSize);
+
+extern void
+RMP_NotifyDeinit(rmp_data_handle_t hObj);
+
+extern void
+RMP_NotifyWrite(rmp_data_handle_t hObj, size_t uWrittenBytesNumb);
+#endif
+
+#if (rmpTIMESTAMP_MARKS_ENABLE == 1)
+extern void
+RMP_TimestampMark(rmp_data_handle_t hObj, size_t uWrittenBytesNumb);
+
+extern void
+RMP_TimestampRelease(rmp_data_handle_t hObj);
+
+extern void
+RMP_TimestampFrame(
+    rmp_data_handle_t hObj,
+    size_t            uFrameStartPos,
+    size_t            uFrameSizeInBytes);
+#endif
+
+extern bool
+RMP_SetFrameHandler(
+    void               *vObj,
+    uint8_t             uType,
+    rmp_frame_handler_t pfnHandler,
+    void               *pvCtx);
+
+#if (rmpMIRROR_MEM_ENABLE == 1)
+extern void *
+RMP_MirrorMemAlloc(size_t uMinSizeInBytes, size_t *puSizeInBytes);
+
+extern bool
+RMP_MirrorMemFree(void *pMem, size_t uSizeInBytes);
+#endif
+
 extern void
 RPM_WriteCrcInMessageTail(void *pvMessage);
 
 extern bool
 RMP_IsCrcValid(void *pvMessage);
 
+extern void
+RMP_WriteFrameCrc(const rmp_frame_desc_t *pxDesc, void *pvFrame);
+
+extern bool
+RMP_IsFrameCrcValid(const rmp_frame_desc_t *pxDesc, const void *pvFrame);
+
+extern bool
+RMP_GetLengthPrefixedFrameDesc(
+    const rmp_frame_desc_t *pxDesc,
+    size_t                  uPayloadSizeInBytes,
+    rmp_frame_desc_t       *pxFrameDesc);
+
+extern size_t
+RMP_IsCrcValidMulti(
+    const void *pvMessages,
+    size_t      uMessagesNumb,
+    bool       *pbIsCrcValid);
+
+extern size_t
+RMP_FindSyncWord(
+    const void *pvMem,
+    size_t      uLen,
+    uint8_t     uFirstByte,
+    uint8_t     uSecondByte);
+
+extern uint16_t
+CORE_GetCrc16_CCITT_Poly0x1021(const void *pSrc, size_t uLen);
+
+extern void
+CORE_GetCrc16_CCITT_Poly0x1021_Multi(
+    const void *pSrc,
+    size_t      uStride,
+    size_t      uLen,
+    size_t      uNumb,
+    uint16_t   *puCrc);
+
 #if (rmpTEST_ENABLE == 1)
 extern rmpPRIVATE size_t
 RMP_Get(void *vObj, void *pDst, size_t uDstMemSize);
@@ -431,11 +1659,46 @@ RMP_FindSecondByte(void *vObj, void *pDst, size_t uDstMemSize);
 extern rmpPRIVATE rmp_return_code
 RMP_WaitAndCopyMessage(void *vObj, void *pDst, size_t uDstMemSize);
 
+extern rmpPRIVATE rmp_return_code
+RMP_WaitAndCopyFrame(void *vObj, void *pDst, size_t uDstMemSize);
+
+extern rmpPRIVATE rmp_return_code
+RMP_ReadFrameLength(void *vObj, void *pDst, size_t uDstMemSize);
+
+extern rmpPRIVATE rmp_return_code
+RMP_WaitAndCopyLengthPrefixedFrame(
+    void  *vObj,
+    void  *pDst,
+    size_t uDstMemSize);
+
+extern rmpPRIVATE rmp_return_code
+RMP_FindAndCopyMessage(void *vObj, void *pDst, size_t uDstMemSize);
+
+extern rmpPRIVATE rmp_return_code
+RMP_FindAndCopyFrame(void *vObj, void *pDst, size_t uDstMemSize);
+
+extern rmpPRIVATE rmp_return_code
+RMP_RunStateTable(void *vObj, void *pDst, size_t uDstMemSize);
+
+extern rmpPRIVATE rmp_return_code
+RMP_RunStateSwitch(void *vObj, void *pDst, size_t uDstMemSize);
+
 extern rmpPRIVATE uint16_t
-CORE_GetCrc16_CCITT_Poly0x1021(const void *pSrc, size_t uLen);
+CORE_UpdateCrc16_CCITT_Poly0x1021_Bitwise(
+    uint16_t    uCrc,
+    const void *pSrc,
+    size_t      uLen);
 
 extern rmpPRIVATE uint16_t
 RMP_GetPackCrc(void *pvMessage);
+
+    #if (rmpCRC_CLMUL_ENABLE == 1)
+extern rmpPRIVATE uint16_t
+CORE_UpdateCrc16_CCITT_Poly0x1021_Clmul(
+    uint16_t    uCrc,
+    const void *pSrc,
+    size_t      uLen);
+    #endif
 #endif
 
 #endif /* RADIO_MESSAGE_PARSER_H */
@@ -34,7 +34,7 @@
  */
 
 #include "radio_message_parser.h"
-#include "lwrb.h"
+#include "radio_message_parser_ring.h"
 
 static size_t
 prvPut(void *vObj, void *pSrc, size_t uBytesNumb);
@@ -42,21 +42,87 @@ prvPut(void *vObj, void *pSrc, size_t uBytesNumb);
 static size_t
 prvPutISR(void *vObj, void *pSrc, size_t uBytesNumb);
 
+static size_t
+prvPutOverwriteOldest(void *vObj, void *pSrc, size_t uBytesNumb);
+
+static size_t
+prvPutDropOldestFrames(void *vObj, void *pSrc, size_t uBytesNumb);
+
+static void *
+prvGetWriteSpan(void *vObj, size_t *puSpanLen);
+
+static size_t
+prvCommitWrite(void *vObj, size_t uBytesNumb);
+
 static size_t
 prvProcessing(void *vObj, void *pDst, size_t uDstMemSize);
 
+static size_t
+prvProcessingEx(
+    void             *vObj,
+    void             *pDst,
+    size_t            uDstMemSize,
+    rmp_frame_info_t *pxInfo);
+
 static size_t
 prvReset(void *vObj);
 
+static const void *
+prvAcquireFrame(void *vObj);
+
+static const void *
+prvFindFrame(void *vObj, bool bIsDispatch);
+
+static void
+prvReleaseFrame(void *vObj);
+
+static size_t
+prvProcessingBatch(
+    void   *vObj,
+    void   *pFrames,
+    size_t  uMaxFramesNumb,
+    size_t  uBudget,
+    size_t *puConsumedBytesNumb);
+
+static size_t
+prvDispatch(void *vObj, size_t uMaxFramesNumb);
+
+static rmp_stop_reason_e
+prvGetStopReason(rmp_data_handle_t hObj, rmp_return_code eReturnCode);
+
+static __rmpFORCE_INLINE bool
+prvIsFrameTypeHandled(rmp_data_handle_t hObj, uint8_t uType);
+
+static bool
+prvIsStagedFrameUnhandled(rmp_data_handle_t hObj);
+
 rmp_api_handle_t
 RMP_InitAPI(void *vObj)
 {
     rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
 
-    hObj->xAPI.Put         = prvPut;
-    hObj->xAPI.PutISR      = prvPutISR;
-    hObj->xAPI.Processing  = prvProcessing;
-    hObj->xAPI.Reset       = prvReset;
+    hObj->xAPI.Put             = prvPut;
+    hObj->xAPI.PutISR          = prvPutISR;
+
+    /* Политика переполнения кольцевого буфера выбирается один раз, а не при
+     * каждой записи */
+    if (hObj->eOverflowPolicy == rmpOVERFLOW_POLICY_OVERWRITE_OLDEST) {
+        hObj->xAPI.Put    = prvPutOverwriteOldest;
+        hObj->xAPI.PutISR = prvPutOverwriteOldest;
+    } else if (hObj->eOverflowPolicy == rmpOVERFLOW_POLICY_DROP_OLDEST_FRAMES) {
+        hObj->xAPI.Put    = prvPutDropOldestFrames;
+        hObj->xAPI.PutISR = prvPutDropOldestFrames;
+    }
+
+    hObj->xAPI.GetWriteSpan    = prvGetWriteSpan;
+    hObj->xAPI.CommitWrite     = prvCommitWrite;
+    hObj->xAPI.Processing      = prvProcessing;
+    hObj->xAPI.Reset           = prvReset;
+    hObj->xAPI.AcquireFrame    = prvAcquireFrame;
+    hObj->xAPI.ReleaseFrame    = prvReleaseFrame;
+    hObj->xAPI.ProcessingBatch = prvProcessingBatch;
+    hObj->xAPI.Dispatch        = prvDispatch;
+    hObj->xAPI.ProcessingEx    = prvProcessingEx;
 
     return (&hObj->xAPI);
 }
@@ -66,7 +132,14 @@ prvPut(void *vObj, void *pSrc, size_t uBytesNumb)
 {
     rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
 
-    return (lwrb_write(&hObj->xLWRB, pSrc, uBytesNumb));
+    size_t uWrittenBytesNumb = RMP_RingWrite(&hObj->xRing, pSrc, uBytesNumb);
+
+    rmpSTATS_ADD(hObj, uIngestedBytesNumb, uWrittenBytesNumb);
+    rmpSTATS_ADD(hObj, uRejectedBytesNumb, uBytesNumb - uWrittenBytesNumb);
+    rmpTIMESTAMP_MARK(hObj, uWrittenBytesNumb);
+    rmpNOTIFY_WRITE(hObj, uWrittenBytesNumb);
+
+    return (uWrittenBytesNumb);
 }
 
 static size_t
@@ -75,6 +148,123 @@ prvPutISR(void *vObj, void *pSrc, size_t uBytesNumb)
     return (prvPut(vObj, pSrc, uBytesNumb));
 }
 
+/**
+ * @brief Put() с политикой <rmpOVERFLOW_POLICY_OVERWRITE_OLDEST>. Повторяет
+ * lwrb_overwrite(), но не использует ее: она удаляет байты внутри lwrb
+ * (lwrb_skip() или lwrb_reset()), минуя счетчик считанных байт и ограничение
+ * чтения обработчика. Здесь байты удаляются через RMP_Skip(), а конечный
+ * автомат возвращается к поиску начала сообщения.
+ */
+static size_t
+prvPutOverwriteOldest(void *vObj, void *pSrc, size_t uBytesNumb)
+{
+    rmp_data_handle_t hObj  = (rmp_data_handle_t) vObj;
+    rmp_ring_t       *pRb   = &hObj->xRing;
+    const uint8_t    *pData = (const uint8_t *) pSrc;
+    size_t            uFree = RMP_RingGetFree(pRb);
+
+    /* Полученное AcquireFrame() сообщение не может быть перезаписано */
+    if ((uBytesNumb <= uFree) || (hObj->pAcquiredFrame != NULL)) {
+        return (prvPut(vObj, pSrc, uBytesNumb));
+    }
+
+    /* Из байт, превышающих емкость буфера, сохраняются самые новые */
+    const size_t uCapacity = RMP_RingGetSize(pRb) - 1u;
+    if (uBytesNumb > uCapacity) {
+        rmpSTATS_ADD(hObj, uRejectedBytesNumb, uBytesNumb - uCapacity);
+
+        pData      += uBytesNumb - uCapacity;
+        uBytesNumb  = uCapacity;
+    }
+
+    /* Начало сообщения могло быть удалено, поэтому поиск начинается
+     * заново */
+    RMP_Skip(vObj, uBytesNumb - uFree);
+    RMP_SetState(vObj, rmpSTATE_FIND_FIRST_BYTE);
+    rmpSTATS_ADD(hObj, uDiscardedBytesNumb, uBytesNumb - uFree);
+
+    return (prvPut(vObj, (void *) pData, uBytesNumb));
+}
+
+static size_t
+prvPutDropOldestFrames(void *vObj, void *pSrc, size_t uBytesNumb)
+{
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+    rmp_ring_t       *pRb  = &hObj->xRing;
+
+    /* Полученное AcquireFrame() сообщение не может быть удалено */
+    if ((uBytesNumb <= RMP_RingGetFree(pRb))
+        || (hObj->pAcquiredFrame != NULL)) {
+        return (prvPut(vObj, pSrc, uBytesNumb));
+    }
+
+    const uint8_t uaSync[2] = {
+        hObj->xFrameDesc.uSyncFirstByte,
+        hObj->xFrameDesc.uSyncSecondByte};
+
+    /* Сообщения удаляются до очередной пары байт начала сообщения. Первое
+     * удаляемое сообщение может быть частично обработано конечным
+     * автоматом, поэтому поиск начинается заново */
+    while ((RMP_RingGetFree(pRb) < uBytesNumb)
+           && (RMP_RingGetFull(pRb) != 0u)) {
+        size_t uSyncIdx = 0u;
+
+        if (RMP_RingFind(pRb, uaSync, sizeof(uaSync), 1u, &uSyncIdx)
+            == false) {
+            uSyncIdx = RMP_RingGetFull(pRb);
+        }
+
+        RMP_Skip(vObj, uSyncIdx);
+        rmpSTATS_ADD(hObj, uDiscardedBytesNumb, uSyncIdx);
+        rmpSTATS_ADD(hObj, uDroppedFramesNumb, 1u);
+    }
+    /* while ((RMP_RingGetFree(pRb) < uBytesNumb) && ...) */
+
+    RMP_SetState(vObj, rmpSTATE_FIND_FIRST_BYTE);
+
+    return (prvPut(vObj, pSrc, uBytesNumb));
+}
+
+static void *
+prvGetWriteSpan(void *vObj, size_t *puSpanLen)
+{
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    /* Для зеркальной области памяти все свободное место расположено
+     * непрерывно. Позиция чтения считывается только если блок меньше
+     * сообщения */
+    const size_t uMinLen  = hObj->xFrameDesc.uFrameSizeInBytes;
+    size_t       uSpanLen = hObj->bIsMirroredMem
+                                ? RMP_RingGetFreeCached(&hObj->xRing, uMinLen)
+                                : RMP_RingGetWriteLength(&hObj->xRing, uMinLen);
+
+    if (puSpanLen != NULL) {
+        *puSpanLen = uSpanLen;
+    }
+
+    /* В кольцевом буфере нет свободного места */
+    if (uSpanLen == 0u) {
+        return (NULL);
+    }
+
+    return (RMP_RingGetWriteAddress(&hObj->xRing));
+}
+
+static size_t
+prvCommitWrite(void *vObj, size_t uBytesNumb)
+{
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    size_t uWrittenBytesNumb = RMP_RingAdvance(&hObj->xRing, uBytesNumb);
+
+    rmpSTATS_ADD(hObj, uIngestedBytesNumb, uWrittenBytesNumb);
+    rmpSTATS_ADD(hObj, uRejectedBytesNumb, uBytesNumb - uWrittenBytesNumb);
+    rmpTIMESTAMP_MARK(hObj, uWrittenBytesNumb);
+    rmpNOTIFY_WRITE(hObj, uWrittenBytesNumb);
+
+    return (uWrittenBytesNumb);
+}
+
 static size_t
 prvProcessing(void *vObj, void *pDst, size_t uDstMemSize)
 {
@@ -82,14 +272,37 @@ prvProcessing(void *vObj, void *pDst, size_t uDstMemSize)
     size_t            uRxMessageSize = 0u;
     rmp_return_code   eReturnCode    = rmpIN_PROGRESS;
 
-    do {
-        eReturnCode =
-            hObj->xStateAPI.aFn[RMP_GetState(vObj)](vObj, pDst, uDstMemSize);
+    hObj->uReadBytesLeft             = (hObj->uReadBytesThreshold == 0u)
+                                           ? SIZE_MAX
+                                           : hObj->uReadBytesThreshold;
 
-        if (eReturnCode == rmpMESSAGE_COPIED) {
-            uRxMessageSize = rmpONE_MESSAGE_SIZE_IN_BYTES;
-        }
-    } while (eReturnCode == rmpIN_PROGRESS);
+    rmpTIMESTAMP_RELEASE(hObj);
+
+    eReturnCode = RMP_RunStateMachine(vObj, pDst, uDstMemSize);
+
+    if (eReturnCode == rmpMESSAGE_COPIED) {
+        uRxMessageSize = hObj->uFrameSizeInBytes;
+    }
+
+    hObj->eStopReason = prvGetStopReason(hObj, eReturnCode);
+
+    return (uRxMessageSize);
+}
+
+static size_t
+prvProcessingEx(
+    void             *vObj,
+    void             *pDst,
+    size_t            uDstMemSize,
+    rmp_frame_info_t *pxInfo)
+{
+    size_t uRxMessageSize = prvProcessing(vObj, pDst, uDstMemSize);
+
+    if ((uRxMessageSize != 0u) && (pxInfo != NULL)) {
+        pxInfo->uFrameSizeInBytes   = uRxMessageSize;
+        pxInfo->bIsRxTimestampValid =
+            RMP_GetFrameRxTimestamp(vObj, &pxInfo->uRxTimestamp);
+    }
 
     return (uRxMessageSize);
 }
@@ -99,10 +312,377 @@ prvReset(void *vObj)
 {
     rmp_data_handle_t hObj            = (rmp_data_handle_t) vObj;
 
-    size_t uBytesNumbInBuffBeforReset = lwrb_get_full(&hObj->xLWRB);
-    lwrb_reset(&hObj->xLWRB);
+    size_t uBytesNumbInBuffBeforReset = RMP_RingGetFull(&hObj->xRing);
+    RMP_RingReset(&hObj->xRing);
+
+    /* Сброшенные байты учитываются как считанные, поэтому позиции потока
+     * по счетчикам записанных и считанных байт совпадают */
+    hObj->uReadBytesCnt             += uBytesNumbInBuffBeforReset;
 
     RMP_SetState(vObj, rmpSTATE_FIND_FIRST_BYTE);
 
+    hObj->pAcquiredFrame            = NULL;
+    hObj->uAcquiredBytesNumb        = 0u;
+
+    rmpSTATS_ADD(hObj, uResetsNumb, 1u);
+
     return (uBytesNumbInBuffBeforReset);
 }
+
+static const void *
+prvAcquireFrame(void *vObj)
+{
+    return (prvFindFrame(vObj, false));
+}
+
+/**
+ * @brief Реализация AcquireFrame(). В режиме <bIsDispatch> возвращаются
+ * только сообщения, для типа которых зарегистрирован обработчик, остальные
+ * сообщения отбрасываются.
+ */
+static const void *
+prvFindFrame(void *vObj, bool bIsDispatch)
+{
+    rmp_data_handle_t       hObj   = (rmp_data_handle_t) vObj;
+    rmp_ring_t             *pRb    = &hObj->xRing;
+    const rmp_frame_desc_t *pxDesc = &hObj->xFrameDesc;
+
+    /* Сообщения без обработчика отбрасываются до проверки контрольной суммы */
+    const bool bIsDropUnregistered =
+        (hObj->pxDispatchTable != NULL) && hObj->bIsDropUnregisteredTypes;
+
+    /* Предыдущее сообщение еще не освобождено */
+    if (hObj->pAcquiredFrame != NULL) {
+        return (hObj->pAcquiredFrame);
+    }
+
+    rmpTIMESTAMP_RELEASE(hObj);
+
+    /* Байты начала сообщения уже считаны из буфера вызовом Processing(),
+     * поэтому сообщение дочитывается конечным автоматом во внутренний буфер */
+    if (RMP_GetState(vObj) != rmpSTATE_FIND_FIRST_BYTE) {
+        /* Как и при поиске в буфере, сообщение без обработчика отбрасывается
+         * до проверки контрольной суммы: конечный автомат без копирования
+         * (размер целевой области 0) доходит до ожидания сообщения */
+        if (bIsDropUnregistered) {
+            (void) prvProcessing(vObj, hObj->uaStaging, 0u);
+
+            if (prvIsStagedFrameUnhandled(hObj)) {
+                RMP_Skip(vObj, hObj->uFrameSizeInBytes - 2u);
+                RMP_SetState(vObj, rmpSTATE_FIND_FIRST_BYTE);
+                rmpSTATS_ADD(hObj, uUnhandledFramesNumb, 1u);
+            }
+        }
+    }
+
+    if (RMP_GetState(vObj) != rmpSTATE_FIND_FIRST_BYTE) {
+        if (prvProcessing(vObj, hObj->uaStaging, sizeof(hObj->uaStaging))
+            != 0u) {
+            const uint8_t uType = hObj->uaStaging[hObj->uDispatchTypeOffset];
+
+            /* Достоверное сообщение без обработчика уже учтено конечным
+             * автоматом как полученное */
+            if (bIsDispatch && !prvIsFrameTypeHandled(hObj, uType)) {
+                rmpSTATS_SUB(hObj, uDeliveredFramesNumb, 1u);
+                rmpSTATS_ADD(hObj, uUnhandledFramesNumb, 1u);
+            } else {
+                hObj->pAcquiredFrame     = hObj->uaStaging;
+                hObj->uAcquiredBytesNumb = 0u;
+
+                return (hObj->pAcquiredFrame);
+            }
+        }
+
+        /* Сообщение еще не получено целиком */
+        if (RMP_GetState(vObj) != rmpSTATE_FIND_FIRST_BYTE) {
+            return (NULL);
+        }
+    }
+    /*------------------------------------------------------------------------*/
+
+    /* Байты начала сообщения не считываются из буфера до вызова
+     * ReleaseFrame(), поэтому Put() не может перезаписать сообщение */
+    while (1) {
+        if (!RMP_RingHasFull(pRb, 2u)) {
+            break;
+        }
+
+        size_t         uLinearLen = 0u;
+        const uint8_t *pMem       = RMP_GetReadSpan(vObj, &uLinearLen);
+
+        size_t uSyncIdx = RMP_FindSyncWord(
+            pMem,
+            uLinearLen,
+            pxDesc->uSyncFirstByte,
+            pxDesc->uSyncSecondByte);
+
+        /* Пара байт не найдена в линейном блоке */
+        if (uSyncIdx == uLinearLen) {
+            if (pMem[uLinearLen - 1u] != pxDesc->uSyncFirstByte) {
+                RMP_Skip(vObj, uLinearLen);
+                rmpSTATS_ADD(hObj, uSkippedBytesNumb, uLinearLen);
+
+                continue;
+            }
+
+            /* Последний байт блока - первый байт пары. Если второй байт еще
+             * не записан, то первый байт остается в буфере */
+            if (!RMP_RingHasFull(pRb, uLinearLen + 1u)) {
+                RMP_Skip(vObj, uLinearLen - 1u);
+                rmpSTATS_ADD(hObj, uSkippedBytesNumb, uLinearLen - 1u);
+
+                break;
+            }
+
+            /* Второй байт пары расположен после точки перехода */
+            uint8_t uSecondByte = 0u;
+            RMP_RingPeek(pRb, uLinearLen, &uSecondByte, sizeof(uSecondByte));
+
+            if (uSecondByte != pxDesc->uSyncSecondByte) {
+                RMP_Skip(vObj, uLinearLen);
+                rmpSTATS_ADD(hObj, uSkippedBytesNumb, uLinearLen);
+                rmpSTATS_ADD(hObj, uFalseFirstByteNumb, 1u);
+
+                continue;
+            }
+
+            uSyncIdx = uLinearLen - 1u;
+        }
+        /* if (uSyncIdx == uLinearLen) */
+
+        /* Отбрасывание байт перед началом сообщения */
+        RMP_Skip(vObj, uSyncIdx);
+        rmpSTATS_ADD(hObj, uSkippedBytesNumb, uSyncIdx);
+
+        /* Размер сообщения переменной длины определяется байтом длины,
+         * следующим за байтами начала сообщения */
+        const rmp_frame_desc_t *pxFrameDesc = pxDesc;
+        rmp_frame_desc_t        xLengthPrefixedDesc;
+
+        if (pxDesc->bIsLengthPrefixed) {
+            uint8_t uLength = 0u;
+            if (RMP_RingPeek(pRb, 2u, &uLength, sizeof(uLength)) == 0u) {
+                break;
+            }
+
+            /* Недопустимая длина, поиск продолжается со следующего байта */
+            if (RMP_GetLengthPrefixedFrameDesc(
+                    pxDesc,
+                    uLength,
+                    &xLengthPrefixedDesc)
+                == false) {
+                rmpSTATS_ADD(hObj, uLengthErrorsNumb, 1u);
+                RMP_Skip(vObj, 1u);
+
+                continue;
+            }
+
+            pxFrameDesc = &xLengthPrefixedDesc;
+        }
+
+        const size_t uFrameSize = pxFrameDesc->uFrameSizeInBytes;
+
+        /* Сообщение еще не получено целиком */
+        if (!RMP_RingHasFull(pRb, uFrameSize)) {
+            break;
+        }
+        /*--------------------------------------------------------------------*/
+
+        uint8_t uType = 0u;
+        if (bIsDispatch || bIsDropUnregistered) {
+            RMP_RingPeek(pRb, hObj->uDispatchTypeOffset, &uType, sizeof(uType));
+        }
+
+        /* Тип сообщения определяется до проверки контрольной суммы, поэтому
+         * сообщение без обработчика отбрасывается целиком */
+        if (bIsDropUnregistered && !prvIsFrameTypeHandled(hObj, uType)) {
+            RMP_Skip(vObj, uFrameSize);
+            rmpSTATS_ADD(hObj, uUnhandledFramesNumb, 1u);
+
+            continue;
+        }
+
+        size_t      uSpanLen = 0u;
+        const void *pFrame   = RMP_GetReadSpan(vObj, &uSpanLen);
+
+        /* Сообщение разделено точкой перехода через границу буфера (не
+         * возникает для зеркальной области памяти) */
+        if (uSpanLen < uFrameSize) {
+            RMP_RingPeek(pRb, 0u, hObj->uaStaging, uFrameSize);
+
+            pFrame = hObj->uaStaging;
+        }
+
+        if (RMP_IsFrameCrcValid(pxFrameDesc, pFrame)) {
+            /* Достоверное сообщение без обработчика */
+            if (bIsDispatch && !prvIsFrameTypeHandled(hObj, uType)) {
+                RMP_Skip(vObj, uFrameSize);
+                rmpSTATS_ADD(hObj, uUnhandledFramesNumb, 1u);
+
+                continue;
+            }
+
+            hObj->pAcquiredFrame     = pFrame;
+            hObj->uAcquiredBytesNumb = uFrameSize;
+            hObj->uFrameSizeInBytes  = uFrameSize;
+            rmpSTATS_ADD(hObj, uDeliveredFramesNumb, 1u);
+            rmpTIMESTAMP_FRAME(hObj, hObj->uReadBytesCnt, uFrameSize);
+
+            return (pFrame);
+        }
+
+        rmpSTATS_ADD(hObj, uCrcErrorsNumb, 1u);
+
+        /* Как и в Processing(): в режиме восстановления синхронизации поиск
+         * продолжится с байта, следующего за парой байт начала сообщения,
+         * иначе отбрасывается все сообщение */
+        RMP_Skip(vObj, hObj->bIsResyncOnCrcError ? 2u : uFrameSize);
+    }
+    /* while (1) */
+
+    return (NULL);
+}
+
+static void
+prvReleaseFrame(void *vObj)
+{
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    if (hObj->pAcquiredFrame != NULL) {
+        RMP_Skip(vObj, hObj->uAcquiredBytesNumb);
+
+        hObj->pAcquiredFrame     = NULL;
+        hObj->uAcquiredBytesNumb = 0u;
+    }
+}
+
+static size_t
+prvProcessingBatch(
+    void   *vObj,
+    void   *pFrames,
+    size_t  uMaxFramesNumb,
+    size_t  uBudget,
+    size_t *puConsumedBytesNumb)
+{
+    rmp_data_handle_t hObj          = (rmp_data_handle_t) vObj;
+    uint8_t          *pFramesMem    = (uint8_t *) pFrames;
+    size_t            uFrameSize    = hObj->xFrameDesc.uFrameSizeInBytes;
+    size_t            uFramesNumb   = 0u;
+    size_t            uReadBytesCnt = hObj->uReadBytesCnt;
+    rmp_return_code   eReturnCode   = rmpIN_PROGRESS;
+
+    hObj->uReadBytesLeft            = (uBudget == 0u) ? SIZE_MAX : uBudget;
+
+    rmpTIMESTAMP_RELEASE(hObj);
+
+    while ((uFramesNumb < uMaxFramesNumb) && (eReturnCode != rmpBREAK)) {
+        /* Сообщение с недостоверной контрольной суммой перезаписывается
+         * следующим найденным сообщением */
+        eReturnCode = RMP_RunStateMachine(
+            vObj,
+            &pFramesMem[uFramesNumb * uFrameSize],
+            uFrameSize);
+
+        if (eReturnCode == rmpMESSAGE_COPIED) {
+            uFramesNumb++;
+        }
+    }
+    /* while ((uFramesNumb < uMaxFramesNumb) && (eReturnCode != rmpBREAK)) */
+
+    hObj->eStopReason = (eReturnCode == rmpBREAK)
+                            ? prvGetStopReason(hObj, eReturnCode)
+                            : rmpSTOP_REASON_FRAMES_BUDGET;
+
+    if (puConsumedBytesNumb != NULL) {
+        *puConsumedBytesNumb = hObj->uReadBytesCnt - uReadBytesCnt;
+    }
+
+    return (uFramesNumb);
+}
+
+static size_t
+prvDispatch(void *vObj, size_t uMaxFramesNumb)
+{
+    rmp_data_handle_t hObj        = (rmp_data_handle_t) vObj;
+    size_t            uFramesNumb = 0u;
+    const uint8_t    *pFrame      = NULL;
+
+    if (hObj->pxDispatchTable == NULL) {
+        return (0u);
+    }
+
+    if (uMaxFramesNumb == 0u) {
+        uMaxFramesNumb = SIZE_MAX;
+    }
+
+    while (uFramesNumb < uMaxFramesNumb) {
+        pFrame = (const uint8_t *) prvFindFrame(vObj, true);
+        if (pFrame == NULL) {
+            break;
+        }
+
+        /* Сообщение остается в кольцевом буфере до возврата из обработчика */
+        const rmp_dispatch_entry_t *pxEntry =
+            &hObj->pxDispatchTable[pFrame[hObj->uDispatchTypeOffset]];
+        pxEntry->pfnHandler(pxEntry->pvCtx, pFrame, hObj->uFrameSizeInBytes);
+
+        prvReleaseFrame(vObj);
+        uFramesNumb++;
+    }
+    /* while (uFramesNumb < uMaxFramesNumb) */
+
+    hObj->eStopReason = (pFrame == NULL) ? rmpSTOP_REASON_NO_DATA
+                                         : rmpSTOP_REASON_FRAMES_BUDGET;
+
+    return (uFramesNumb);
+}
+
+static __rmpFORCE_INLINE bool
+prvIsFrameTypeHandled(rmp_data_handle_t hObj, uint8_t uType)
+{
+    return (hObj->pxDispatchTable[uType].pfnHandler != NULL);
+}
+
+/**
+ * @brief Проверяет, что сообщение, байты начала которого считаны конечным
+ * автоматом (состояние ожидания сообщения), записано в буфер целиком и для
+ * его типа не зарегистрирован обработчик. Контрольная сумма не проверяется.
+ */
+static bool
+prvIsStagedFrameUnhandled(rmp_data_handle_t hObj)
+{
+    const size_t uTypeOffset = hObj->uDispatchTypeOffset;
+    uint8_t      uType       = hObj->xFrameDesc.uSyncFirstByte;
+
+    if ((RMP_GetState(hObj) != rmpSTATE_WAIT_AND_COPY_MESSAGE)
+        || !RMP_RingHasFull(&hObj->xRing, hObj->uFrameSizeInBytes - 2u)) {
+        return (false);
+    }
+
+    /* Байты начала сообщения уже считаны из буфера */
+    if (uTypeOffset >= 2u) {
+        RMP_RingPeek(&hObj->xRing, uTypeOffset - 2u, &uType, sizeof(uType));
+    } else if (uTypeOffset == 1u) {
+        uType = hObj->xFrameDesc.uSyncSecondByte;
+    }
+
+    return (!prvIsFrameTypeHandled(hObj, uType));
+}
+
+static rmp_stop_reason_e
+prvGetStopReason(rmp_data_handle_t hObj, rmp_return_code eReturnCode)
+{
+    /* Сообщение извлечено из буфера (в том числе с недостоверной контрольной
+     * суммой) */
+    if (eReturnCode != rmpBREAK) {
+        return (rmpSTOP_REASON_FRAMES_BUDGET);
+    }
+
+    /* Обработка прервана ограничением количества байт, при этом в буфере
+     * остались байты */
+    if ((hObj->uReadBytesLeft == 0u) && (RMP_RingGetFull(&hObj->xRing) != 0u)) {
+        return (rmpSTOP_REASON_BYTES_BUDGET);
+    }
+
+    return (rmpSTOP_REASON_NO_DATA);
+}
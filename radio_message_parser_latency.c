@@ -0,0 +1,571 @@
+/**
+ * @file radio_message_parser_latency.c
+ * @author Mickle Isaev (mrraptor26@gmail.com)
+ *
+ * @brief Метки времени записи: измерение задержки сообщений от записи в
+ * кольцевой буфер до передачи пользовательскому коду и определение времени
+ * поступления сообщений.
+ *
+ * При записи блока байт (Put(), PutISR(), CommitWrite()) в очередь
+ * помещается метка: значение счетчика записанных байт после записи и время
+ * записи. Позиция байта в потоке определяется счетчиками записанных и
+ * считанных байт, поэтому при передаче сообщения по позициям его первого и
+ * последнего байт находятся метки блоков, в которых они были записаны.
+ * Задержка добавляется в гистограмму с логарифмически-линейными интервалами
+ * (HDR) фиксированного размера, а время поступления первого байта сообщения
+ * определяется по метке его блока с учетом положения байта в блоке.
+ *
+ * Очередь меток заполняется при записи и освобождается при обработке байт,
+ * поэтому запись и обработка могут выполняться в разных потоках (в том числе
+ * в прерывании). Гистограммы изменяются и считываются только в потоке
+ * обработки.
+ *
+ * @version 1.0.2
+ *
+ * @copyright Copyright (c) 2024 StilSoft
+ *
+ * MIT License:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the 'Software'), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "radio_message_parser.h"
+
+#if (rmpTIMESTAMP_MARKS_ENABLE == 1)
+
+    #if ((rmpTIMESTAMP_MARKS_NUMB & (rmpTIMESTAMP_MARKS_NUMB - 1u)) != 0u)
+        #error "rmpTIMESTAMP_MARKS_NUMB must be a power of 2"
+    #endif
+
+    #define rmpTIMESTAMP_MARK_IDX(uCnt)                                        \
+        ((uCnt) & (rmpTIMESTAMP_MARKS_NUMB - 1u))
+
+static bool
+prvIsPosBefore(size_t uPos, size_t uEndPos);
+
+static void
+prvReleaseMarks(rmp_data_handle_t hObj, size_t uPos);
+
+    #if (rmpRX_TIMESTAMP_ENABLE == 1)
+static uint64_t
+prvGetByteTimestamp(
+    rmp_data_handle_t           hObj,
+    size_t                      uPos,
+    const rmp_timestamp_mark_t *pxMark);
+    #endif
+#endif /* (rmpTIMESTAMP_MARKS_ENABLE == 1) */
+
+#if (rmpLATENCY_ENABLE == 1)
+
+    #if (rmpLATENCY_HIST_SUB_BUCKET_BITS < 1u)                                \
+        || (rmpLATENCY_HIST_SUB_BUCKET_BITS >= rmpLATENCY_HIST_MAX_BITS)      \
+        || (rmpLATENCY_HIST_MAX_BITS > 64u)
+        #error "Invalid latency histogram precision or range"
+    #endif
+
+    #define rmpLATENCY_HIST_MAX_VALUE                                          \
+        (UINT64_MAX >> (64u - rmpLATENCY_HIST_MAX_BITS))
+
+static unsigned
+prvGetMsb(uint64_t uValue);
+
+static size_t
+prvGetBucketIdx(uint64_t uValue);
+
+static uint64_t
+prvGetBucketHighestValue(size_t uIdx);
+
+static void
+prvHistRecord(rmp_latency_hist_t *pxHist, uint64_t uValue);
+#endif /* (rmpLATENCY_ENABLE == 1) */
+
+#if (rmpTIMESTAMP_MARKS_ENABLE == 1)
+/**
+ * @brief Сохраняет метку времени записи блока байт. Если очередь меток
+ * заполнена, то метка не сохраняется, а байты блока будут отнесены к
+ * следующей метке.
+ *
+ * @param[out] hObj: Указатель на объект обработчика сообщений.
+ * @param[in] uWrittenBytesNumb: Количество записанных байт.
+ */
+void
+RMP_TimestampMark(rmp_data_handle_t hObj, size_t uWrittenBytesNumb)
+{
+    if ((uWrittenBytesNumb == 0u) || (hObj->pfnGetTimestamp == NULL)) {
+        return;
+    }
+
+    hObj->uWriteBytesCnt += uWrittenBytesNumb;
+
+    size_t uHead =
+        atomic_load_explicit(&hObj->uMarksHead, memory_order_relaxed);
+    size_t uTail =
+        atomic_load_explicit(&hObj->uMarksTail, memory_order_acquire);
+
+    if ((uHead - uTail) >= rmpTIMESTAMP_MARKS_NUMB) {
+        return;
+    }
+
+    rmp_timestamp_mark_t *pxMark = &hObj->xaMarks[rmpTIMESTAMP_MARK_IDX(uHead)];
+    pxMark->uEndPos              = hObj->uWriteBytesCnt;
+    pxMark->uTimestamp           = hObj->pfnGetTimestamp();
+
+    atomic_store_explicit(&hObj->uMarksHead, uHead + 1u, memory_order_release);
+}
+
+/**
+ * @brief Освобождает метки блоков, целиком считанных из кольцевого буфера.
+ * Вызывается в начале обработки, чтобы очередь меток не заполнялась при
+ * длительном отсутствии сообщений. Байты начала сообщения, считанные
+ * конечным автоматом, остаются под меткой до получения сообщения.
+ *
+ * @param[out] hObj: Указатель на объект обработчика сообщений.
+ */
+void
+RMP_TimestampRelease(rmp_data_handle_t hObj)
+{
+    size_t uPos = hObj->uReadBytesCnt;
+
+    switch (hObj->eState) {
+        case rmpSTATE_FIND_FIRST_BYTE:
+            break;
+
+        case rmpSTATE_FIND_SECOND_BYTE:
+            uPos -= 1u;
+            break;
+
+        default:
+            uPos -= 2u;
+            break;
+    }
+
+    prvReleaseMarks(hObj, uPos);
+}
+
+/**
+ * @brief Определяет время поступления первого байта сообщения, переданного
+ * пользовательскому коду, и добавляет задержки сообщения в гистограммы. Для
+ * байт, метка которых еще не сохранена, используется текущее время.
+ *
+ * @param[out] hObj: Указатель на объект обработчика сообщений.
+ * @param[in] uFrameStartPos: Позиция первого байта сообщения (значение
+ * счетчика считанных байт перед его чтением).
+ * @param[in] uFrameSizeInBytes: Размер сообщения.
+ */
+void
+RMP_TimestampFrame(
+    rmp_data_handle_t hObj,
+    size_t            uFrameStartPos,
+    size_t            uFrameSizeInBytes)
+{
+    #if (rmpRX_TIMESTAMP_ENABLE == 1)
+    hObj->bIsFrameRxTimestampValid = false;
+    #endif
+
+    if (hObj->pfnGetTimestamp == NULL) {
+        return;
+    }
+
+    const uint64_t uNow = hObj->pfnGetTimestamp();
+
+    /* Метки блоков, целиком расположенных перед сообщением, больше не
+     * нужны (следующие сообщения расположены дальше в потоке) */
+    prvReleaseMarks(hObj, uFrameStartPos);
+
+    size_t uHead =
+        atomic_load_explicit(&hObj->uMarksHead, memory_order_acquire);
+    size_t uTail =
+        atomic_load_explicit(&hObj->uMarksTail, memory_order_relaxed);
+
+    const rmp_timestamp_mark_t *pxFirstMark = NULL;
+    if (uTail != uHead) {
+        pxFirstMark = &hObj->xaMarks[rmpTIMESTAMP_MARK_IDX(uTail)];
+    }
+    /*------------------------------------------------------------------------*/
+
+    #if (rmpRX_TIMESTAMP_ENABLE == 1)
+    hObj->uFrameRxTimestamp =
+        (pxFirstMark != NULL)
+            ? prvGetByteTimestamp(hObj, uFrameStartPos, pxFirstMark)
+            : uNow;
+    hObj->bIsFrameRxTimestampValid = true;
+    #endif
+    /*------------------------------------------------------------------------*/
+
+    #if (rmpLATENCY_ENABLE == 1)
+    const size_t uLastPos = uFrameStartPos + uFrameSizeInBytes - 1u;
+    uint64_t     uFirstTs = uNow;
+    uint64_t     uLastTs  = uNow;
+
+    if (pxFirstMark != NULL) {
+        uFirstTs = pxFirstMark->uTimestamp;
+    }
+
+    for (size_t i = uTail; i != uHead; ++i) {
+        const rmp_timestamp_mark_t *pxMark =
+            &hObj->xaMarks[rmpTIMESTAMP_MARK_IDX(i)];
+
+        if (prvIsPosBefore(uLastPos, pxMark->uEndPos)) {
+            uLastTs = pxMark->uTimestamp;
+
+            break;
+        }
+    }
+
+    prvHistRecord(
+        &hObj->xaLatencyHist[rmpLATENCY_FIRST_BYTE],
+        (uNow > uFirstTs) ? (uNow - uFirstTs) : 0u);
+    prvHistRecord(
+        &hObj->xaLatencyHist[rmpLATENCY_LAST_BYTE],
+        (uNow > uLastTs) ? (uNow - uLastTs) : 0u);
+    #else
+    (void) uFrameSizeInBytes;
+    #endif
+}
+
+/**
+ * @brief Возвращает true, если позиция <uPos> расположена в потоке перед
+ * позицией <uEndPos> (счетчики позиций переполняются).
+ */
+static bool
+prvIsPosBefore(size_t uPos, size_t uEndPos)
+{
+    return ((size_t) (uEndPos - uPos - 1u) < (SIZE_MAX / 2u));
+}
+
+/**
+ * @brief Освобождает метки блоков, целиком расположенных перед позицией
+ * <uPos>. Последняя освобожденная метка сохраняется для определения времени
+ * поступления байт следующего блока.
+ */
+static void
+prvReleaseMarks(rmp_data_handle_t hObj, size_t uPos)
+{
+    size_t uHead =
+        atomic_load_explicit(&hObj->uMarksHead, memory_order_acquire);
+    size_t uTail =
+        atomic_load_explicit(&hObj->uMarksTail, memory_order_relaxed);
+    size_t uOldTail = uTail;
+
+    while ((uTail != uHead)
+           && !prvIsPosBefore(
+               uPos,
+               hObj->xaMarks[rmpTIMESTAMP_MARK_IDX(uTail)].uEndPos)) {
+        uTail++;
+    }
+
+    if (uTail == uOldTail) {
+        return;
+    }
+
+    #if (rmpRX_TIMESTAMP_ENABLE == 1)
+    hObj->xPrevMark        = hObj->xaMarks[rmpTIMESTAMP_MARK_IDX(uTail - 1u)];
+    hObj->bIsPrevMarkValid = true;
+    #endif
+
+    atomic_store_explicit(&hObj->uMarksTail, uTail, memory_order_release);
+}
+
+    #if (rmpRX_TIMESTAMP_ENABLE == 1)
+/**
+ * @brief Возвращает время поступления байта в позиции <uPos>, расположенного
+ * в блоке записи с меткой <pxMark> (см. <uByteDuration> в <rmp_init_t>).
+ */
+static uint64_t
+prvGetByteTimestamp(
+    rmp_data_handle_t           hObj,
+    size_t                      uPos,
+    const rmp_timestamp_mark_t *pxMark)
+{
+    const uint64_t uMarkTs     = pxMark->uTimestamp;
+    const uint64_t uPrevTs     = hObj->xPrevMark.uTimestamp;
+    const size_t   uBytesAfter = pxMark->uEndPos - uPos - 1u;
+
+    /* Байты блока поступали с известным интервалом до момента его записи */
+    if (hObj->uByteDuration != 0u) {
+        uint64_t uTs = 0u;
+        if (uBytesAfter <= (uMarkTs / hObj->uByteDuration)) {
+            uTs = uMarkTs - (uint64_t) uBytesAfter * hObj->uByteDuration;
+        }
+
+        if (hObj->bIsPrevMarkValid && (uTs < uPrevTs)) {
+            uTs = uPrevTs;
+        }
+
+        return (uTs);
+    }
+
+    /* Байты блока поступали равномерно после записи предыдущего блока */
+    if (!hObj->bIsPrevMarkValid || (uMarkTs <= uPrevTs)) {
+        return (uMarkTs);
+    }
+
+    const size_t uChunkLen = pxMark->uEndPos - hObj->xPrevMark.uEndPos;
+    const size_t uByteIdx  = uChunkLen - uBytesAfter;
+
+    return (
+        uPrevTs
+        + (uint64_t) ((double) (uMarkTs - uPrevTs) * (double) uByteIdx
+                      / (double) uChunkLen));
+}
+    #endif
+#endif /* (rmpTIMESTAMP_MARKS_ENABLE == 1) */
+
+#if (rmpLATENCY_ENABLE == 1)
+static unsigned
+prvGetMsb(uint64_t uValue)
+{
+    #if defined(__GNUC__)
+    return (63u - (unsigned) __builtin_clzll(uValue));
+    #else
+    unsigned uMsb = 0u;
+    while ((uValue >>= 1u) != 0u) {
+        uMsb++;
+    }
+
+    return (uMsb);
+    #endif
+}
+
+/**
+ * @brief Возвращает индекс интервала гистограммы. Значения меньше
+ * 2^rmpLATENCY_HIST_SUB_BUCKET_BITS учитываются точно, далее каждый интервал
+ * [2^k, 2^(k+1)) делится на 2^(rmpLATENCY_HIST_SUB_BUCKET_BITS - 1) равных
+ * частей.
+ */
+static size_t
+prvGetBucketIdx(uint64_t uValue)
+{
+    if (uValue > rmpLATENCY_HIST_MAX_VALUE) {
+        uValue = rmpLATENCY_HIST_MAX_VALUE;
+    }
+
+    if (uValue < (1u << rmpLATENCY_HIST_SUB_BUCKET_BITS)) {
+        return ((size_t) uValue);
+    }
+
+    const unsigned uShift =
+        prvGetMsb(uValue) - rmpLATENCY_HIST_SUB_BUCKET_BITS + 1u;
+
+    return (
+        ((size_t) uShift << (rmpLATENCY_HIST_SUB_BUCKET_BITS - 1u))
+        + (size_t) (uValue >> uShift));
+}
+
+/**
+ * @brief Возвращает наибольшее значение, учитываемое в интервале <uIdx>.
+ */
+static uint64_t
+prvGetBucketHighestValue(size_t uIdx)
+{
+    if (uIdx < (1u << rmpLATENCY_HIST_SUB_BUCKET_BITS)) {
+        return ((uint64_t) uIdx);
+    }
+
+    const unsigned uShift =
+        (unsigned) (uIdx >> (rmpLATENCY_HIST_SUB_BUCKET_BITS - 1u)) - 1u;
+    const uint64_t uSub =
+        (uint64_t) uIdx
+        - ((uint64_t) uShift << (rmpLATENCY_HIST_SUB_BUCKET_BITS - 1u));
+
+    return (((uSub + 1u) << uShift) - 1u);
+}
+
+static void
+prvHistRecord(rmp_latency_hist_t *pxHist, uint64_t uValue)
+{
+    if ((pxHist->uTotalCnt == 0u) || (uValue < pxHist->uMin)) {
+        pxHist->uMin = uValue;
+    }
+
+    if (uValue > pxHist->uMax) {
+        pxHist->uMax = uValue;
+    }
+
+    uint32_t *puCnt = &pxHist->uaCnt[prvGetBucketIdx(uValue)];
+    if (*puCnt != UINT32_MAX) {
+        (*puCnt)++;
+    }
+
+    pxHist->uTotalCnt++;
+}
+
+#endif /* (rmpLATENCY_ENABLE == 1) */
+
+/**
+ * @brief Возвращает значение задержки, не превышаемое заданной долей
+ * сообщений. Значение определяется с точностью интервала гистограммы (см.
+ * <rmpLATENCY_HIST_SUB_BUCKET_BITS>) и не выходит за пределы наименьшей и
+ * наибольшей измеренной задержки.
+ *
+ * @note Функция вызывается в потоке обработки байт (Processing() и др.).
+ *
+ * @param[in] vObj: Указатель на объект обработчика сообщений.
+ * @param[in] eLatency: Измеряемая задержка.
+ * @param[in] dPercentile: Доля сообщений в процентах (0 - наименьшая
+ * задержка, 100 - наибольшая).
+ * @param[out] puValue: Задержка в единицах функции получения метки времени.
+ *
+ * @return false, если измерение задержки выключено (см. <rmpLATENCY_ENABLE>)
+ * или задержка еще не измерена.
+ */
+bool
+RMP_GetLatencyPercentile(
+    void         *vObj,
+    rmp_latency_e eLatency,
+    double        dPercentile,
+    uint64_t     *puValue)
+{
+#if (rmpLATENCY_ENABLE == 1)
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    if ((hObj == NULL) || (puValue == NULL)
+        || (eLatency >= rmpLATENCY_MAX_NUMB)) {
+        return (false);
+    }
+
+    const rmp_latency_hist_t *pxHist = &hObj->xaLatencyHist[eLatency];
+
+    if (pxHist->uTotalCnt == 0u) {
+        return (false);
+    }
+
+    if (dPercentile <= 0.0) {
+        *puValue = pxHist->uMin;
+
+        return (true);
+    }
+
+    if (dPercentile >= 100.0) {
+        *puValue = pxHist->uMax;
+
+        return (true);
+    }
+    /*------------------------------------------------------------------------*/
+
+    /* Номер измерения (с 1) в порядке возрастания задержки */
+    uint64_t uRank =
+        (uint64_t) ((dPercentile / 100.0) * (double) pxHist->uTotalCnt);
+    if ((double) uRank < ((dPercentile / 100.0) * (double) pxHist->uTotalCnt)) {
+        uRank++;
+    }
+
+    uint64_t uCnt   = 0u;
+    uint64_t uValue = pxHist->uMax;
+
+    for (size_t i = 0u; i < rmpLATENCY_HIST_BUCKETS_NUMB; ++i) {
+        uCnt += pxHist->uaCnt[i];
+
+        if (uCnt >= uRank) {
+            uValue = prvGetBucketHighestValue(i);
+
+            break;
+        }
+    }
+
+    if (uValue > pxHist->uMax) {
+        uValue = pxHist->uMax;
+    }
+
+    if (uValue < pxHist->uMin) {
+        uValue = pxHist->uMin;
+    }
+
+    *puValue = uValue;
+
+    return (true);
+#else
+    (void) vObj;
+    (void) eLatency;
+    (void) dPercentile;
+    (void) puValue;
+
+    return (false);
+#endif
+}
+
+/**
+ * @brief Очищает гистограммы задержки. Метки времени записи сохраняются.
+ *
+ * @note Функция вызывается в потоке обработки байт (Processing() и др.).
+ *
+ * @param[out] vObj: Указатель на объект обработчика сообщений.
+ *
+ * @return false, если измерение задержки выключено (см. <rmpLATENCY_ENABLE>).
+ */
+bool
+RMP_ResetLatency(void *vObj)
+{
+#if (rmpLATENCY_ENABLE == 1)
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    if (hObj == NULL) {
+        return (false);
+    }
+
+    memset((void *) hObj->xaLatencyHist, 0, sizeof(hObj->xaLatencyHist));
+
+    return (true);
+#else
+    (void) vObj;
+
+    return (false);
+#endif
+}
+
+/**
+ * @brief Возвращает время поступления первого байта начала последнего
+ * сообщения, переданного пользовательскому коду (Processing(),
+ * AcquireFrame(), обработчику Dispatch() и др.). Для ProcessingBatch()
+ * возвращается время последнего сообщения группы.
+ *
+ * Время определяется по метке блока записи, содержащего байт (см.
+ * <uByteDuration> в <rmp_init_t>).
+ *
+ * @param[in] vObj: Указатель на объект обработчика сообщений.
+ * @param[out] puRxTimestamp: Время в единицах функции получения метки
+ * времени.
+ *
+ * @return false, если определение времени выключено (см.
+ * <rmpRX_TIMESTAMP_ENABLE>), функция получения метки времени не задана или
+ * сообщение еще не получено.
+ */
+bool
+RMP_GetFrameRxTimestamp(void *vObj, uint64_t *puRxTimestamp)
+{
+#if (rmpRX_TIMESTAMP_ENABLE == 1)
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    if ((hObj == NULL) || (puRxTimestamp == NULL)
+        || !hObj->bIsFrameRxTimestampValid) {
+        return (false);
+    }
+
+    *puRxTimestamp = hObj->uFrameRxTimestamp;
+
+    return (true);
+#else
+    (void) vObj;
+    (void) puRxTimestamp;
+
+    return (false);
+#endif
+}
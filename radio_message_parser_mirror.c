@@ -0,0 +1,151 @@
+/**
+ * @file radio_message_parser_mirror.c
+ * @author Mickle Isaev (mrraptor26@gmail.com)
+ *
+ * @brief Выделение зеркальной области памяти кольцевого буфера (только Linux).
+ *
+ * Одни и те же страницы памяти (memfd) отображаются в адресное пространство
+ * процесса дважды, одно отображение непосредственно за другим. Байт по адресу
+ * <pMem + uSize + i> совпадает с байтом по адресу <pMem + i>, поэтому любая
+ * последовательность непрочитанных байт кольцевого буфера расположена в
+ * памяти непрерывно.
+ *
+ * @version 1.0.2
+ *
+ * @copyright Copyright (c) 2024 StilSoft
+ *
+ * MIT License:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the 'Software'), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
+#include "radio_message_parser.h"
+
+#if (rmpMIRROR_MEM_ENABLE == 1)
+
+    #include <sys/mman.h>
+    #include <unistd.h>
+
+/**
+ * @brief Выделяет зеркальную область памяти для кольцевого буфера.
+ *
+ * @param[in] uMinSizeInBytes: Минимальный размер кольцевого буфера. Размер
+ * округляется вверх до размера страницы памяти.
+ *
+ * @param[out] puSizeInBytes: Размер кольцевого буфера после округления,
+ * передается в <uMemAllocSizeInBytes> (см. <rmp_init_t>).
+ *
+ * @return Адрес области памяти или NULL в случае ошибки. Адресное пространство
+ * занимает <2 * (*puSizeInBytes)> байт.
+ */
+void *
+RMP_MirrorMemAlloc(size_t uMinSizeInBytes, size_t *puSizeInBytes)
+{
+    if ((uMinSizeInBytes == 0u) || (puSizeInBytes == NULL)) {
+        return (NULL);
+    }
+
+    long lPageSize = sysconf(_SC_PAGESIZE);
+    if (lPageSize <= 0) {
+        return (NULL);
+    }
+
+    size_t uPageSize = (size_t) lPageSize;
+    size_t uSize =
+        (uMinSizeInBytes + uPageSize - 1u) / uPageSize * uPageSize;
+
+    int iFd = memfd_create("rmp_ring", MFD_CLOEXEC);
+    if (iFd < 0) {
+        return (NULL);
+    }
+
+    uint8_t *pMem = MAP_FAILED;
+
+    if (ftruncate(iFd, (off_t) uSize) == 0) {
+        /* Резервирование адресного пространства под оба отображения */
+        pMem = mmap(
+            NULL,
+            2u * uSize,
+            PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS,
+            -1,
+            0);
+    }
+
+    if (pMem != MAP_FAILED) {
+        void *pLow = mmap(
+            pMem,
+            uSize,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_FIXED,
+            iFd,
+            0);
+
+        void *pHigh = mmap(
+            pMem + uSize,
+            uSize,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_FIXED,
+            iFd,
+            0);
+
+        if ((pLow != (void *) pMem) || (pHigh != (void *) (pMem + uSize))) {
+            munmap(pMem, 2u * uSize);
+
+            pMem = MAP_FAILED;
+        }
+    }
+
+    /* Отображения сохраняют ссылку на memfd */
+    close(iFd);
+
+    if (pMem == MAP_FAILED) {
+        return (NULL);
+    }
+
+    *puSizeInBytes = uSize;
+
+    return (pMem);
+}
+
+/**
+ * @brief Освобождает область памяти, выделенную RMP_MirrorMemAlloc().
+ *
+ * @param[in] pMem: Адрес области памяти.
+ *
+ * @param[in] uSizeInBytes: Размер кольцевого буфера, возвращенный
+ * RMP_MirrorMemAlloc().
+ *
+ * @return true в случае успеха.
+ */
+bool
+RMP_MirrorMemFree(void *pMem, size_t uSizeInBytes)
+{
+    if ((pMem == NULL) || (uSizeInBytes == 0u)) {
+        return (false);
+    }
+
+    return (munmap(pMem, 2u * uSizeInBytes) == 0);
+}
+
+#endif /* (rmpMIRROR_MEM_ENABLE == 1) */
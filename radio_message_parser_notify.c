@@ -0,0 +1,347 @@
+/**
+ * @file radio_message_parser_notify.c
+ * @author Mickle Isaev (mrraptor26@gmail.com)
+ *
+ * @brief Ожидание сообщения без опроса кольцевого буфера (только Linux).
+ *
+ * Поток обработки перед ожиданием определяет, сколько байт еще не хватает
+ * для получения сообщения минимального размера (с учетом уже считанных
+ * конечным автоматом байт текущего сообщения), и сохраняет значение счетчика
+ * записанных байт, при котором сообщение может быть получено. Put(),
+ * PutISR() и CommitWrite() увеличивают счетчик и, если ожидание разрешено и
+ * значение достигнуто, однократно записывают в eventfd. Пока поток обработки
+ * не ожидает, запись выполняется без системных вызовов.
+ *
+ * Оценка количества недостающих байт не превышает действительного значения,
+ * поэтому поток обработки может быть пробужден раньше, чем сообщение будет
+ * записано полностью (в этом случае Processing() возвращает 0 и ожидание
+ * повторяется), но не позже.
+ *
+ * @version 1.0.2
+ *
+ * @copyright Copyright (c) 2024 StilSoft
+ *
+ * MIT License:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the 'Software'), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "radio_message_parser.h"
+#include "radio_message_parser_ring.h"
+
+#if (rmpNOTIFY_ENABLE == 1)
+
+    #if !defined(__linux__)
+        #error "rmpNOTIFY_ENABLE requires Linux (eventfd)"
+    #endif
+
+    #include <limits.h>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <unistd.h>
+
+static bool
+prvIsCntReached(size_t uCnt, size_t uTarget);
+
+static size_t
+prvGetMissingBytesNumb(rmp_data_handle_t hObj);
+
+static void
+prvDrainFd(rmp_data_handle_t hObj);
+
+/**
+ * @brief Создает eventfd пробуждения потока обработки.
+ *
+ * @param[out] hObj: Указатель на объект обработчика сообщений.
+ * @param[in] uMinFrameSize: Минимальный размер сообщения.
+ *
+ * @return false, если eventfd не создан.
+ */
+bool
+RMP_NotifyInit(rmp_data_handle_t hObj, size_t uMinFrameSize)
+{
+    hObj->uNotifyMinFrameSize = uMinFrameSize;
+    atomic_init(&hObj->uNotifyWriteCnt, 0u);
+    atomic_init(&hObj->uNotifyTarget, 0u);
+    atomic_init(&hObj->bIsNotifyArmed, false);
+
+    hObj->iNotifyFd = eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    return (hObj->iNotifyFd >= 0);
+}
+
+void
+RMP_NotifyDeinit(rmp_data_handle_t hObj)
+{
+    if (hObj->iNotifyFd >= 0) {
+        close(hObj->iNotifyFd);
+
+        hObj->iNotifyFd = -1;
+    }
+}
+
+/**
+ * @brief Учитывает записанные байты и пробуждает поток обработки, если
+ * записано достаточно байт для получения сообщения. Вызывается после записи
+ * байт в кольцевой буфер.
+ *
+ * @param[out] hObj: Указатель на объект обработчика сообщений.
+ * @param[in] uWrittenBytesNumb: Количество записанных байт.
+ */
+void
+RMP_NotifyWrite(rmp_data_handle_t hObj, size_t uWrittenBytesNumb)
+{
+    if (uWrittenBytesNumb == 0u) {
+        return;
+    }
+
+    const size_t uCnt =
+        atomic_load_explicit(&hObj->uNotifyWriteCnt, memory_order_relaxed)
+        + uWrittenBytesNumb;
+    atomic_store_explicit(&hObj->uNotifyWriteCnt, uCnt, memory_order_release);
+
+    /* Запись счетчика и чтение признака ожидания упорядочены с записью
+     * признака ожидания и чтением счетчика в RMP_ArmFrameNotify(): хотя бы
+     * одна из сторон видит изменение другой */
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (!atomic_load_explicit(&hObj->bIsNotifyArmed, memory_order_acquire)) {
+        return;
+    }
+
+    const size_t uTarget =
+        atomic_load_explicit(&hObj->uNotifyTarget, memory_order_relaxed);
+
+    /* Признак ожидания сбрасывается одной стороной, поэтому поток обработки
+     * пробуждается однократно */
+    if (prvIsCntReached(uCnt, uTarget)
+        && atomic_exchange_explicit(
+            &hObj->bIsNotifyArmed,
+            false,
+            memory_order_relaxed)) {
+        (void) eventfd_write(hObj->iNotifyFd, 1u);
+    }
+}
+
+/**
+ * @brief Проверяет, что счетчик записанных байт <uCnt> достиг значения
+ * <uTarget> (с учетом переполнения счетчика).
+ */
+static bool
+prvIsCntReached(size_t uCnt, size_t uTarget)
+{
+    return ((uCnt - uTarget) <= (SIZE_MAX / 2u));
+}
+
+/**
+ * @brief Возвращает нижнюю оценку количества байт, которые должны быть
+ * записаны для получения сообщения (0, если сообщение может быть получено
+ * без записи).
+ */
+static size_t
+prvGetMissingBytesNumb(rmp_data_handle_t hObj)
+{
+    size_t uFrameSize   = hObj->uNotifyMinFrameSize;
+    size_t uConsumedLen = 0u;
+
+    /* Байты начала сообщения уже считаны конечным автоматом. Размер
+     * сообщения переменной длины известен после чтения байта длины */
+    switch (hObj->eState) {
+        case rmpSTATE_FIND_SECOND_BYTE:
+            uConsumedLen = 1u;
+            break;
+
+        case rmpSTATE_READ_LENGTH:
+            uConsumedLen = 2u;
+            break;
+
+        case rmpSTATE_WAIT_AND_COPY_MESSAGE:
+            uConsumedLen = 2u;
+            uFrameSize   = hObj->uFrameSizeInBytes;
+            break;
+
+        default:
+            break;
+    }
+
+    const size_t uAvailableLen = uConsumedLen + RMP_RingGetFull(&hObj->xRing);
+
+    return ((uFrameSize > uAvailableLen) ? (uFrameSize - uAvailableLen) : 0u);
+}
+
+/**
+ * @brief Сбрасывает счетчик eventfd (пробуждение, полученное после
+ * завершения ожидания).
+ */
+static void
+prvDrainFd(rmp_data_handle_t hObj)
+{
+    eventfd_t uValue = 0u;
+
+    (void) eventfd_read(hObj->iNotifyFd, &uValue);
+}
+
+#endif /* (rmpNOTIFY_ENABLE == 1) */
+
+/**
+ * @brief Разрешает пробуждение потока обработки (eventfd, см.
+ * RMP_GetNotifyFd()) при записи байт, достаточных для получения сообщения.
+ * Предназначена для ожидания в пользовательском цикле событий (poll/epoll),
+ * для блокирующего ожидания используйте RMP_WaitForFrame(). Вызывается из
+ * потока обработки после Processing(), вернувшей 0.
+ *
+ * @param[in] vObj: Указатель на объект обработчика сообщений.
+ *
+ * @return true, если байты уже записаны и ожидание не требуется; false, если
+ * пробуждение разрешено или ожидание выключено (см. <rmpNOTIFY_ENABLE>).
+ */
+bool
+RMP_ArmFrameNotify(void *vObj)
+{
+#if (rmpNOTIFY_ENABLE == 1)
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    if (hObj == NULL) {
+        return (false);
+    }
+
+    prvDrainFd(hObj);
+
+    /* Счетчик считывается до заполнения кольцевого буфера: байты, записанные
+     * между чтениями, только уменьшают ожидаемое значение счетчика */
+    const size_t uCnt =
+        atomic_load_explicit(&hObj->uNotifyWriteCnt, memory_order_acquire);
+    const size_t uMissingLen = prvGetMissingBytesNumb(hObj);
+
+    if (uMissingLen == 0u) {
+        return (true);
+    }
+
+    const size_t uTarget = uCnt + uMissingLen;
+    atomic_store_explicit(&hObj->uNotifyTarget, uTarget, memory_order_relaxed);
+    atomic_store_explicit(&hObj->bIsNotifyArmed, true, memory_order_release);
+
+    atomic_thread_fence(memory_order_seq_cst);
+
+    /* Байты записаны до разрешения пробуждения */
+    if (prvIsCntReached(
+            atomic_load_explicit(&hObj->uNotifyWriteCnt, memory_order_relaxed),
+            uTarget)
+        && atomic_exchange_explicit(
+            &hObj->bIsNotifyArmed,
+            false,
+            memory_order_relaxed)) {
+        return (true);
+    }
+
+    return (false);
+#else
+    (void) vObj;
+
+    return (false);
+#endif
+}
+
+/**
+ * @brief Возвращает дескриптор eventfd, который становится доступным для
+ * чтения при пробуждении потока обработки (см. RMP_ArmFrameNotify()).
+ *
+ * @param[in] vObj: Указатель на объект обработчика сообщений.
+ *
+ * @return Дескриптор или -1, если ожидание выключено (см.
+ * <rmpNOTIFY_ENABLE>).
+ */
+int
+RMP_GetNotifyFd(void *vObj)
+{
+#if (rmpNOTIFY_ENABLE == 1)
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    return ((hObj != NULL) ? hObj->iNotifyFd : -1);
+#else
+    (void) vObj;
+
+    return (-1);
+#endif
+}
+
+/**
+ * @brief Блокирует поток обработки до записи байт, достаточных для получения
+ * сообщения, или до истечения тайм-аута. Используется вместо периодического
+ * вызова Processing():
+ *
+ *      while (1) {
+ *          if (hAPI->Processing(hAPI, &xMsg, sizeof(xMsg)) == 0u) {
+ *              RMP_WaitForFrame(hAPI, 100u);
+ *          }
+ *      }
+ *
+ * Байты, записанные после пробуждения, пробуждение не повторяют, поэтому при
+ * постоянном потоке сообщений системные вызовы выполняются только когда
+ * поток обработки успевает обработать все записанные байты.
+ *
+ * @param[in] vObj: Указатель на объект обработчика сообщений.
+ * @param[in] uTimeoutMs: Тайм-аут в миллисекундах (<rmpNOTIFY_WAIT_FOREVER> -
+ * без ограничения, 0 - без ожидания).
+ *
+ * @return true, если байты записаны (сообщение может оказаться неполным или
+ * ложным, тогда ожидание повторяется); false при истечении тайм-аута, ошибке
+ * или выключенном ожидании (см. <rmpNOTIFY_ENABLE>).
+ */
+bool
+RMP_WaitForFrame(void *vObj, uint32_t uTimeoutMs)
+{
+#if (rmpNOTIFY_ENABLE == 1)
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    if (hObj == NULL) {
+        return (false);
+    }
+
+    if (RMP_ArmFrameNotify(vObj)) {
+        return (true);
+    }
+
+    struct pollfd xPollFd = {.fd = hObj->iNotifyFd, .events = POLLIN};
+
+    const int iTimeoutMs =
+        (uTimeoutMs == rmpNOTIFY_WAIT_FOREVER)
+            ? -1
+            : ((uTimeoutMs > (uint32_t) INT_MAX) ? INT_MAX : (int) uTimeoutMs);
+
+    const bool bIsWoken = (poll(&xPollFd, 1u, iTimeoutMs) > 0);
+
+    /* Если пробуждение разрешено, то запись в eventfd не выполнялась.
+     * Иначе запись выполнена (или будет выполнена) Put() и сбрасывается при
+     * следующем ожидании */
+    const bool bIsArmed = atomic_exchange_explicit(
+        &hObj->bIsNotifyArmed,
+        false,
+        memory_order_relaxed);
+
+    prvDrainFd(hObj);
+
+    return (bIsWoken || !bIsArmed);
+#else
+    (void) vObj;
+    (void) uTimeoutMs;
+
+    return (false);
+#endif
+}
@@ -0,0 +1,808 @@
+/**
+ * @file radio_message_parser_ring.h
+ * @author Mickle Isaev (mrraptor26@gmail.com)
+ *
+ * @brief Функции кольцевого буфера обработчика сообщений для реализации,
+ * выбранной <rmpRING_BACKEND>. Функции повторяют поведение lwrb: буфер
+ * размером N байт вмещает N - 1 байт, байты записываются в память
+ * последовательно с переходом в начало буфера, поэтому расположение байт в
+ * памяти (в том числе для зеркальной области памяти) не зависит от
+ * реализации.
+ *
+ * Функции потребителя (чтение) вызываются только из Processing() и
+ * производных функций, функции производителя (запись) - только из Put().
+ *
+ * @copyright Copyright (c) 2024 StilSoft
+ */
+
+#ifndef RADIO_MESSAGE_PARSER_RING_H
+#define RADIO_MESSAGE_PARSER_RING_H
+
+#include <string.h>
+#include "radio_message_parser.h"
+
+#if (rmpRING_BACKEND == rmpRING_BACKEND_SPSC)
+
+static __rmpFORCE_INLINE size_t
+prvRingGetFull(size_t uR, size_t uW, size_t uSize)
+{
+    return ((uW >= uR) ? (uW - uR) : (uSize - (uR - uW)));
+}
+
+static __rmpFORCE_INLINE size_t
+prvRingGetFree(size_t uR, size_t uW, size_t uSize)
+{
+    return (uSize - prvRingGetFull(uR, uW, uSize) - 1u);
+}
+
+/**
+ * @brief Обновляет копию позиции записи (потребитель). Байты до позиции
+ * записи видны после ее чтения с упорядочиванием <memory_order_acquire>.
+ */
+static __rmpFORCE_INLINE size_t
+prvRingSyncW(rmp_ring_t *pRing)
+{
+    pRing->uCachedW = atomic_load_explicit(&pRing->uW, memory_order_acquire);
+
+    return (pRing->uCachedW);
+}
+
+/**
+ * @brief Обновляет копию позиции чтения (производитель).
+ */
+static __rmpFORCE_INLINE size_t
+prvRingSyncR(rmp_ring_t *pRing)
+{
+    pRing->uCachedR = atomic_load_explicit(&pRing->uR, memory_order_acquire);
+
+    return (pRing->uCachedR);
+}
+
+/**
+ * @brief Количество байт, доступных для чтения, не меньше <uMinLen>, если
+ * столько байт записано. Позиция записи считывается только если копии
+ * недостаточно.
+ */
+static __rmpFORCE_INLINE size_t
+prvRingGetAvail(rmp_ring_t *pRing, size_t uR, size_t uMinLen)
+{
+    size_t uFull = prvRingGetFull(uR, pRing->uCachedW, pRing->uSize);
+
+    if (uFull < uMinLen) {
+        uFull = prvRingGetFull(uR, prvRingSyncW(pRing), pRing->uSize);
+    }
+
+    return (uFull);
+}
+
+static __rmpFORCE_INLINE bool
+RMP_RingInit(rmp_ring_t *pRing, void *pMem, size_t uSize)
+{
+    if ((pMem == NULL) || (uSize == 0u)) {
+        return (false);
+    }
+
+    pRing->pBuff         = (uint8_t *) pMem;
+    pRing->uSize         = uSize;
+    pRing->uCachedW      = 0u;
+    pRing->pProducerBuff = (uint8_t *) pMem;
+    pRing->uProducerSize = uSize;
+    pRing->uCachedR      = 0u;
+    atomic_init(&pRing->uR, 0u);
+    atomic_init(&pRing->uW, 0u);
+
+    return (true);
+}
+
+static __rmpFORCE_INLINE void
+RMP_RingFree(rmp_ring_t *pRing)
+{
+    pRing->pBuff         = NULL;
+    pRing->pProducerBuff = NULL;
+}
+
+/**
+ * @brief Отбрасывает все записанные байты. В отличие от lwrb_reset() позиция
+ * записи не изменяется, поэтому вызов из потока потребителя безопасен.
+ */
+static __rmpFORCE_INLINE void
+RMP_RingReset(rmp_ring_t *pRing)
+{
+    const size_t uW = prvRingSyncW(pRing);
+
+    atomic_store_explicit(&pRing->uR, uW, memory_order_release);
+}
+
+static __rmpFORCE_INLINE const uint8_t *
+RMP_RingGetBuff(const rmp_ring_t *pRing)
+{
+    return (pRing->pBuff);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetSize(const rmp_ring_t *pRing)
+{
+    return (pRing->uSize);
+}
+/*----------------------------------------------------------------------------*/
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFull(rmp_ring_t *pRing)
+{
+    const size_t uR = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+
+    return (prvRingGetFull(uR, prvRingSyncW(pRing), pRing->uSize));
+}
+
+/**
+ * @brief Количество байт в буфере по копии позиции записи: значение может
+ * быть меньше записанных данных, но не меньше <uMinLen>, если столько байт
+ * записано.
+ */
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFullCached(rmp_ring_t *pRing, size_t uMinLen)
+{
+    const size_t uR = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+
+    return (prvRingGetAvail(pRing, uR, uMinLen));
+}
+
+static __rmpFORCE_INLINE const uint8_t *
+RMP_RingGetReadAddress(rmp_ring_t *pRing)
+{
+    return (
+        &pRing->pBuff[atomic_load_explicit(&pRing->uR, memory_order_relaxed)]);
+}
+
+/**
+ * @brief Длина непрерывного блока для чтения. Блок может быть короче
+ * записанных данных, если копия позиции записи устарела, но не пустой, если
+ * данные записаны.
+ */
+static __rmpFORCE_INLINE size_t
+RMP_RingGetReadLength(rmp_ring_t *pRing)
+{
+    const size_t uR = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+    size_t       uW = pRing->uCachedW;
+
+    if (uW == uR) {
+        uW = prvRingSyncW(pRing);
+    }
+
+    return ((uW >= uR) ? (uW - uR) : (pRing->uSize - uR));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingSkip(rmp_ring_t *pRing, size_t uLen)
+{
+    size_t uR = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+
+    const size_t uFull = prvRingGetAvail(pRing, uR, uLen);
+    if (uLen > uFull) {
+        uLen = uFull;
+    }
+
+    uR += uLen;
+    if (uR >= pRing->uSize) {
+        uR -= pRing->uSize;
+    }
+
+    atomic_store_explicit(&pRing->uR, uR, memory_order_release);
+
+    return (uLen);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingPeek(rmp_ring_t *pRing, size_t uSkip, void *pDst, size_t uLen)
+{
+    size_t uR = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+
+    const size_t uFull = prvRingGetAvail(pRing, uR, uSkip + uLen);
+    if (uSkip >= uFull) {
+        return (0u);
+    }
+
+    if (uLen > (uFull - uSkip)) {
+        uLen = uFull - uSkip;
+    }
+
+    uR += uSkip;
+    if (uR >= pRing->uSize) {
+        uR -= pRing->uSize;
+    }
+
+    /* Данные могут располагаться до и после точки перехода */
+    size_t uLinearLen = pRing->uSize - uR;
+    if (uLinearLen > uLen) {
+        uLinearLen = uLen;
+    }
+
+    memcpy(pDst, &pRing->pBuff[uR], uLinearLen);
+    memcpy((uint8_t *) pDst + uLinearLen, pRing->pBuff, uLen - uLinearLen);
+
+    return (uLen);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingRead(rmp_ring_t *pRing, void *pDst, size_t uLen)
+{
+    uLen = RMP_RingPeek(pRing, 0u, pDst, uLen);
+
+    return (RMP_RingSkip(pRing, uLen));
+}
+
+/**
+ * @brief Поиск последовательности байт <pNeedle> начиная с байта
+ * <uStartOffset> (аналог lwrb_find()).
+ */
+static __rmpFORCE_INLINE bool
+RMP_RingFind(
+    rmp_ring_t *pRing,
+    const void *pNeedle,
+    size_t      uNeedleLen,
+    size_t      uStartOffset,
+    size_t     *puFoundIdx)
+{
+    const uint8_t *pNeedleMem = (const uint8_t *) pNeedle;
+    const size_t   uFull      = RMP_RingGetFull(pRing);
+    const size_t   uR =
+        atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+
+    for (size_t uIdx = uStartOffset; (uIdx + uNeedleLen) <= uFull; ++uIdx) {
+        size_t i = 0u;
+
+        for (; i < uNeedleLen; ++i) {
+            if (pRing->pBuff[(uR + uIdx + i) % pRing->uSize]
+                != pNeedleMem[i]) {
+                break;
+            }
+        }
+
+        if (i == uNeedleLen) {
+            *puFoundIdx = uIdx;
+
+            return (true);
+        }
+    }
+
+    return (false);
+}
+/*----------------------------------------------------------------------------*/
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFree(rmp_ring_t *pRing)
+{
+    const size_t uW = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+
+    return (prvRingGetFree(prvRingSyncR(pRing), uW, pRing->uProducerSize));
+}
+
+/**
+ * @brief Свободное место по копии позиции чтения: значение может быть меньше
+ * свободного места, но не меньше <uMinLen>, если столько места свободно.
+ */
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFreeCached(rmp_ring_t *pRing, size_t uMinLen)
+{
+    const size_t uW = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+    size_t uFree    = prvRingGetFree(pRing->uCachedR, uW, pRing->uProducerSize);
+
+    if (uFree < uMinLen) {
+        uFree = prvRingGetFree(prvRingSyncR(pRing), uW, pRing->uProducerSize);
+    }
+
+    return (uFree);
+}
+
+static __rmpFORCE_INLINE uint8_t *
+RMP_RingGetWriteAddress(rmp_ring_t *pRing)
+{
+    return (&pRing->pProducerBuff[atomic_load_explicit(
+        &pRing->uW,
+        memory_order_relaxed)]);
+}
+
+static __rmpFORCE_INLINE size_t
+prvRingGetWriteLength(size_t uR, size_t uW, size_t uSize)
+{
+    if (uW >= uR) {
+        /* При нулевой позиции чтения последний байт буфера не может быть
+         * записан: позиции совпали бы, и буфер считался бы пустым */
+        return (uSize - uW - ((uR == 0u) ? 1u : 0u));
+    }
+
+    return (uR - uW - 1u);
+}
+
+/**
+ * @brief Длина непрерывного блока для записи. Позиция чтения считывается
+ * только если блок по копии короче <uMinLen> и не доходит до конца буфера.
+ */
+static __rmpFORCE_INLINE size_t
+RMP_RingGetWriteLength(rmp_ring_t *pRing, size_t uMinLen)
+{
+    const size_t uW    = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+    const size_t uSize = pRing->uProducerSize;
+
+    size_t uLen = prvRingGetWriteLength(pRing->uCachedR, uW, uSize);
+
+    if ((uLen < uMinLen) && (uLen < (uSize - uW))) {
+        uLen = prvRingGetWriteLength(prvRingSyncR(pRing), uW, uSize);
+    }
+
+    return (uLen);
+}
+
+/**
+ * @brief Подтверждает запись <uLen> байт (не более свободного места).
+ * Позиция чтения считывается только если копии недостаточно.
+ */
+static __rmpFORCE_INLINE size_t
+RMP_RingAdvance(rmp_ring_t *pRing, size_t uLen)
+{
+    size_t uW    = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+    size_t uFree = prvRingGetFree(pRing->uCachedR, uW, pRing->uProducerSize);
+
+    if (uFree < uLen) {
+        uFree = prvRingGetFree(prvRingSyncR(pRing), uW, pRing->uProducerSize);
+    }
+
+    if (uLen > uFree) {
+        uLen = uFree;
+    }
+
+    uW += uLen;
+    if (uW >= pRing->uProducerSize) {
+        uW -= pRing->uProducerSize;
+    }
+
+    atomic_store_explicit(&pRing->uW, uW, memory_order_release);
+
+    return (uLen);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingWrite(rmp_ring_t *pRing, const void *pSrc, size_t uLen)
+{
+    const size_t uW = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+    size_t uFree    = prvRingGetFree(pRing->uCachedR, uW, pRing->uProducerSize);
+
+    if (uFree < uLen) {
+        uFree = prvRingGetFree(prvRingSyncR(pRing), uW, pRing->uProducerSize);
+    }
+
+    if (uLen > uFree) {
+        uLen = uFree;
+    }
+
+    /* Байты копируются до публикации позиции записи */
+    size_t uLinearLen = pRing->uProducerSize - uW;
+    if (uLinearLen > uLen) {
+        uLinearLen = uLen;
+    }
+
+    memcpy(&pRing->pProducerBuff[uW], pSrc, uLinearLen);
+    memcpy(
+        pRing->pProducerBuff,
+        (const uint8_t *) pSrc + uLinearLen,
+        uLen - uLinearLen);
+
+    return (RMP_RingAdvance(pRing, uLen));
+}
+
+#elif (rmpRING_BACKEND == rmpRING_BACKEND_POW2)
+
+/**
+ * @brief Количество байт в буфере. Разность свободно увеличивающихся позиций
+ * корректна и после переполнения счетчиков.
+ */
+static __rmpFORCE_INLINE size_t
+prvRingGetFull(size_t uR, size_t uW)
+{
+    return (uW - uR);
+}
+
+static __rmpFORCE_INLINE bool
+RMP_RingInit(rmp_ring_t *pRing, void *pMem, size_t uSize)
+{
+    if ((pMem == NULL) || (uSize < 2u) || ((uSize & (uSize - 1u)) != 0u)) {
+        return (false);
+    }
+
+    pRing->pBuff = (uint8_t *) pMem;
+    pRing->uMask = uSize - 1u;
+    atomic_init(&pRing->uR, 0u);
+    atomic_init(&pRing->uW, 0u);
+
+    return (true);
+}
+
+static __rmpFORCE_INLINE void
+RMP_RingFree(rmp_ring_t *pRing)
+{
+    pRing->pBuff = NULL;
+}
+
+/**
+ * @brief Отбрасывает все записанные байты без изменения позиции записи.
+ */
+static __rmpFORCE_INLINE void
+RMP_RingReset(rmp_ring_t *pRing)
+{
+    const size_t uW = atomic_load_explicit(&pRing->uW, memory_order_acquire);
+
+    atomic_store_explicit(&pRing->uR, uW, memory_order_release);
+}
+
+static __rmpFORCE_INLINE const uint8_t *
+RMP_RingGetBuff(const rmp_ring_t *pRing)
+{
+    return (pRing->pBuff);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetSize(const rmp_ring_t *pRing)
+{
+    return (pRing->uMask + 1u);
+}
+/*----------------------------------------------------------------------------*/
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFull(rmp_ring_t *pRing)
+{
+    const size_t uR = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+    const size_t uW = atomic_load_explicit(&pRing->uW, memory_order_acquire);
+
+    return (prvRingGetFull(uR, uW));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFullCached(rmp_ring_t *pRing, size_t uMinLen)
+{
+    (void) uMinLen;
+
+    return (RMP_RingGetFull(pRing));
+}
+
+static __rmpFORCE_INLINE const uint8_t *
+RMP_RingGetReadAddress(rmp_ring_t *pRing)
+{
+    const size_t uR = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+
+    return (&pRing->pBuff[uR & pRing->uMask]);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetReadLength(rmp_ring_t *pRing)
+{
+    const size_t uFull = RMP_RingGetFull(pRing);
+    const size_t uR    = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+
+    const size_t uLinearLen = pRing->uMask + 1u - (uR & pRing->uMask);
+
+    return ((uFull < uLinearLen) ? uFull : uLinearLen);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingSkip(rmp_ring_t *pRing, size_t uLen)
+{
+    const size_t uR    = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+    const size_t uW    = atomic_load_explicit(&pRing->uW, memory_order_acquire);
+    const size_t uFull = prvRingGetFull(uR, uW);
+
+    if (uLen > uFull) {
+        uLen = uFull;
+    }
+
+    atomic_store_explicit(&pRing->uR, uR + uLen, memory_order_release);
+
+    return (uLen);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingPeek(rmp_ring_t *pRing, size_t uSkip, void *pDst, size_t uLen)
+{
+    const size_t uR    = atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+    const size_t uW    = atomic_load_explicit(&pRing->uW, memory_order_acquire);
+    const size_t uFull = prvRingGetFull(uR, uW);
+
+    if (uSkip >= uFull) {
+        return (0u);
+    }
+
+    if (uLen > (uFull - uSkip)) {
+        uLen = uFull - uSkip;
+    }
+
+    /* Данные могут располагаться до и после точки перехода */
+    const size_t uOffset    = (uR + uSkip) & pRing->uMask;
+    size_t       uLinearLen = pRing->uMask + 1u - uOffset;
+    if (uLinearLen > uLen) {
+        uLinearLen = uLen;
+    }
+
+    memcpy(pDst, &pRing->pBuff[uOffset], uLinearLen);
+    memcpy((uint8_t *) pDst + uLinearLen, pRing->pBuff, uLen - uLinearLen);
+
+    return (uLen);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingRead(rmp_ring_t *pRing, void *pDst, size_t uLen)
+{
+    uLen = RMP_RingPeek(pRing, 0u, pDst, uLen);
+
+    return (RMP_RingSkip(pRing, uLen));
+}
+
+/**
+ * @brief Поиск последовательности байт <pNeedle> начиная с байта
+ * <uStartOffset> (аналог lwrb_find()).
+ */
+static __rmpFORCE_INLINE bool
+RMP_RingFind(
+    rmp_ring_t *pRing,
+    const void *pNeedle,
+    size_t      uNeedleLen,
+    size_t      uStartOffset,
+    size_t     *puFoundIdx)
+{
+    const uint8_t *pNeedleMem = (const uint8_t *) pNeedle;
+    const size_t   uFull      = RMP_RingGetFull(pRing);
+    const size_t   uR =
+        atomic_load_explicit(&pRing->uR, memory_order_relaxed);
+
+    for (size_t uIdx = uStartOffset; (uIdx + uNeedleLen) <= uFull; ++uIdx) {
+        size_t i = 0u;
+
+        for (; i < uNeedleLen; ++i) {
+            if (pRing->pBuff[(uR + uIdx + i) & pRing->uMask]
+                != pNeedleMem[i]) {
+                break;
+            }
+        }
+
+        if (i == uNeedleLen) {
+            *puFoundIdx = uIdx;
+
+            return (true);
+        }
+    }
+
+    return (false);
+}
+/*----------------------------------------------------------------------------*/
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFree(rmp_ring_t *pRing)
+{
+    const size_t uR = atomic_load_explicit(&pRing->uR, memory_order_acquire);
+    const size_t uW = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+
+    return (pRing->uMask - prvRingGetFull(uR, uW));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFreeCached(rmp_ring_t *pRing, size_t uMinLen)
+{
+    (void) uMinLen;
+
+    return (RMP_RingGetFree(pRing));
+}
+
+static __rmpFORCE_INLINE uint8_t *
+RMP_RingGetWriteAddress(rmp_ring_t *pRing)
+{
+    const size_t uW = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+
+    return (&pRing->pBuff[uW & pRing->uMask]);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetWriteLength(rmp_ring_t *pRing, size_t uMinLen)
+{
+    (void) uMinLen;
+
+    const size_t uFree = RMP_RingGetFree(pRing);
+    const size_t uW    = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+
+    const size_t uLinearLen = pRing->uMask + 1u - (uW & pRing->uMask);
+
+    return ((uFree < uLinearLen) ? uFree : uLinearLen);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingAdvance(rmp_ring_t *pRing, size_t uLen)
+{
+    const size_t uW    = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+    const size_t uFree = RMP_RingGetFree(pRing);
+
+    if (uLen > uFree) {
+        uLen = uFree;
+    }
+
+    atomic_store_explicit(&pRing->uW, uW + uLen, memory_order_release);
+
+    return (uLen);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingWrite(rmp_ring_t *pRing, const void *pSrc, size_t uLen)
+{
+    const size_t uW    = atomic_load_explicit(&pRing->uW, memory_order_relaxed);
+    const size_t uFree = RMP_RingGetFree(pRing);
+
+    if (uLen > uFree) {
+        uLen = uFree;
+    }
+
+    /* Байты копируются до публикации позиции записи */
+    const size_t uOffset    = uW & pRing->uMask;
+    size_t       uLinearLen = pRing->uMask + 1u - uOffset;
+    if (uLinearLen > uLen) {
+        uLinearLen = uLen;
+    }
+
+    memcpy(&pRing->pBuff[uOffset], pSrc, uLinearLen);
+    memcpy(
+        pRing->pBuff,
+        (const uint8_t *) pSrc + uLinearLen,
+        uLen - uLinearLen);
+
+    atomic_store_explicit(&pRing->uW, uW + uLen, memory_order_release);
+
+    return (uLen);
+}
+
+#else /* (rmpRING_BACKEND == rmpRING_BACKEND_LWRB) */
+
+static __rmpFORCE_INLINE bool
+RMP_RingInit(rmp_ring_t *pRing, void *pMem, size_t uSize)
+{
+    return (lwrb_init(pRing, pMem, uSize) != 0u);
+}
+
+static __rmpFORCE_INLINE void
+RMP_RingFree(rmp_ring_t *pRing)
+{
+    lwrb_free(pRing);
+}
+
+static __rmpFORCE_INLINE void
+RMP_RingReset(rmp_ring_t *pRing)
+{
+    lwrb_reset(pRing);
+}
+
+static __rmpFORCE_INLINE const uint8_t *
+RMP_RingGetBuff(const rmp_ring_t *pRing)
+{
+    return (pRing->buff);
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetSize(const rmp_ring_t *pRing)
+{
+    return (pRing->size);
+}
+/*----------------------------------------------------------------------------*/
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFull(rmp_ring_t *pRing)
+{
+    return (lwrb_get_full(pRing));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFullCached(rmp_ring_t *pRing, size_t uMinLen)
+{
+    (void) uMinLen;
+
+    return (lwrb_get_full(pRing));
+}
+
+static __rmpFORCE_INLINE const uint8_t *
+RMP_RingGetReadAddress(rmp_ring_t *pRing)
+{
+    return ((const uint8_t *) lwrb_get_linear_block_read_address(pRing));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetReadLength(rmp_ring_t *pRing)
+{
+    return (lwrb_get_linear_block_read_length(pRing));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingSkip(rmp_ring_t *pRing, size_t uLen)
+{
+    return (lwrb_skip(pRing, uLen));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingPeek(rmp_ring_t *pRing, size_t uSkip, void *pDst, size_t uLen)
+{
+    return (lwrb_peek(pRing, uSkip, pDst, uLen));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingRead(rmp_ring_t *pRing, void *pDst, size_t uLen)
+{
+    return (lwrb_read(pRing, pDst, uLen));
+}
+
+static __rmpFORCE_INLINE bool
+RMP_RingFind(
+    rmp_ring_t *pRing,
+    const void *pNeedle,
+    size_t      uNeedleLen,
+    size_t      uStartOffset,
+    size_t     *puFoundIdx)
+{
+    lwrb_sz_t uFoundIdx = 0u;
+
+    if (lwrb_find(pRing, pNeedle, uNeedleLen, uStartOffset, &uFoundIdx)
+        == 0u) {
+        return (false);
+    }
+
+    *puFoundIdx = uFoundIdx;
+
+    return (true);
+}
+/*----------------------------------------------------------------------------*/
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFree(rmp_ring_t *pRing)
+{
+    return (lwrb_get_free(pRing));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetFreeCached(rmp_ring_t *pRing, size_t uMinLen)
+{
+    (void) uMinLen;
+
+    return (lwrb_get_free(pRing));
+}
+
+static __rmpFORCE_INLINE uint8_t *
+RMP_RingGetWriteAddress(rmp_ring_t *pRing)
+{
+    return ((uint8_t *) lwrb_get_linear_block_write_address(pRing));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingGetWriteLength(rmp_ring_t *pRing, size_t uMinLen)
+{
+    (void) uMinLen;
+
+    return (lwrb_get_linear_block_write_length(pRing));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingAdvance(rmp_ring_t *pRing, size_t uLen)
+{
+    return (lwrb_advance(pRing, uLen));
+}
+
+static __rmpFORCE_INLINE size_t
+RMP_RingWrite(rmp_ring_t *pRing, const void *pSrc, size_t uLen)
+{
+    return (lwrb_write(pRing, pSrc, uLen));
+}
+
+#endif /* (rmpRING_BACKEND == rmpRING_BACKEND_SPSC) */
+
+/**
+ * @brief Проверяет, что в буфере не менее <uLen> байт. Для SPSC позиция
+ * записи считывается только если копии недостаточно; точное количество байт
+ * возвращает RMP_RingGetFull().
+ */
+static __rmpFORCE_INLINE bool
+RMP_RingHasFull(rmp_ring_t *pRing, size_t uLen)
+{
+    return (RMP_RingGetFullCached(pRing, uLen) >= uLen);
+}
+
+#endif /* RADIO_MESSAGE_PARSER_RING_H */
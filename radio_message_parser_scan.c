@@ -0,0 +1,196 @@
+/**
+ * @file radio_message_parser_scan.c
+ * @author Mickle Isaev (mrraptor26@gmail.com)
+ *
+ * @brief RMP расшифровывается как <Radio Message Parser>. Библиотека содержит
+ * программную реализацию парсера сообщений фиксированной длины и предназначена
+ * для выполнения в стиле <Bare Metal>.
+ *
+ * Более подробное описание вы можете найти в <radio_message_parser.h>.
+ *
+ * @version 1.0.2
+ *
+ * @copyright Copyright (c) 2024 StilSoft
+ *
+ * MIT License:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the 'Software'), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "radio_message_parser.h"
+
+#if (rmpSYNC_SCAN_SIMD_ENABLE == 1)
+    #if !defined(__x86_64__) || !defined(__GNUC__)
+        #error "SIMD sync scan requires x86-64 and GCC compatible compiler"
+    #endif
+
+    #include <immintrin.h>
+
+    #define __rmpAVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+/**
+ * @brief Скалярный поиск пары байт: memchr() по первому байту с проверкой
+ * следующего за ним байта.
+ */
+static size_t
+prvFindSyncWordScalar(
+    const uint8_t *pMem,
+    size_t         uLen,
+    uint8_t        uFirstByte,
+    uint8_t        uSecondByte)
+{
+    size_t uIdx = 0u;
+
+    while ((uLen - uIdx) >= 2u) {
+        const uint8_t *pFirstByte =
+            memchr(&pMem[uIdx], uFirstByte, uLen - uIdx - 1u);
+
+        if (pFirstByte == NULL) {
+            break;
+        }
+
+        uIdx = (size_t) (pFirstByte - pMem);
+
+        if (pMem[uIdx + 1u] == uSecondByte) {
+            return (uIdx);
+        }
+
+        uIdx++;
+    }
+    /* while ((uLen - uIdx) >= 2u) */
+
+    return (uLen);
+}
+
+#if (rmpSYNC_SCAN_SIMD_ENABLE == 1)
+/**
+ * @brief Поиск пары байт блоками по 16 байт (SSE2 входит в базовый набор
+ * инструкций x86-64). Для каждой позиции сравниваются блок со смещением 0 с
+ * первым байтом и блок со смещением 1 со вторым байтом.
+ */
+static size_t
+prvFindSyncWordSSE2(
+    const uint8_t *pMem,
+    size_t         uLen,
+    uint8_t        uFirstByte,
+    uint8_t        uSecondByte)
+{
+    const __m128i xFirst  = _mm_set1_epi8((char) uFirstByte);
+    const __m128i xSecond = _mm_set1_epi8((char) uSecondByte);
+
+    size_t uIdx           = 0u;
+
+    for (; (uIdx + 17u) <= uLen; uIdx += 16u) {
+        __m128i xLo = _mm_loadu_si128((const __m128i *) &pMem[uIdx]);
+        __m128i xHi = _mm_loadu_si128((const __m128i *) &pMem[uIdx + 1u]);
+
+        unsigned uMask = (unsigned) _mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(xLo, xFirst),
+            _mm_cmpeq_epi8(xHi, xSecond)));
+
+        if (uMask != 0u) {
+            return (uIdx + (size_t) __builtin_ctz(uMask));
+        }
+    }
+
+    return (
+        uIdx
+        + prvFindSyncWordScalar(
+            &pMem[uIdx],
+            uLen - uIdx,
+            uFirstByte,
+            uSecondByte));
+}
+
+static __rmpAVX2_TARGET size_t
+prvFindSyncWordAVX2(
+    const uint8_t *pMem,
+    size_t         uLen,
+    uint8_t        uFirstByte,
+    uint8_t        uSecondByte)
+{
+    const __m256i xFirst  = _mm256_set1_epi8((char) uFirstByte);
+    const __m256i xSecond = _mm256_set1_epi8((char) uSecondByte);
+
+    size_t uIdx           = 0u;
+
+    for (; (uIdx + 33u) <= uLen; uIdx += 32u) {
+        __m256i xLo = _mm256_loadu_si256((const __m256i *) &pMem[uIdx]);
+        __m256i xHi = _mm256_loadu_si256((const __m256i *) &pMem[uIdx + 1u]);
+
+        unsigned uMask = (unsigned) _mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(xLo, xFirst),
+            _mm256_cmpeq_epi8(xHi, xSecond)));
+
+        if (uMask != 0u) {
+            return (uIdx + (size_t) __builtin_ctz(uMask));
+        }
+    }
+
+    return (
+        uIdx
+        + prvFindSyncWordSSE2(
+            &pMem[uIdx],
+            uLen - uIdx,
+            uFirstByte,
+            uSecondByte));
+}
+#endif
+
+/**
+ * @brief Выполняет поиск первого вхождения пары байт <uFirstByte, uSecondByte>
+ * в линейной области памяти.
+ *
+ * @note При сборке с rmpSYNC_SCAN_SIMD_ENABLE используются инструкции
+ * SSE2/AVX2 (AVX2 выбирается во время выполнения), иначе - скалярный поиск.
+ *
+ * @note Если пара не найдена, последний байт области памяти может оказаться
+ * первым байтом пары, второй байт которой еще не записан или расположен после
+ * точки перехода кольцевого буфера. Данный случай обрабатывается вызывающей
+ * функцией.
+ *
+ * @param[in] pvMem: Указатель на начало области памяти.
+ * @param[in] uLen: Размер области памяти в байтах.
+ * @param[in] uFirstByte: Первый байт пары.
+ * @param[in] uSecondByte: Второй байт пары.
+ *
+ * @return Смещение первого байта найденной пары или <uLen>, если пара не
+ * найдена.
+ */
+size_t
+RMP_FindSyncWord(
+    const void *pvMem,
+    size_t      uLen,
+    uint8_t     uFirstByte,
+    uint8_t     uSecondByte)
+{
+    const uint8_t *pMem = (const uint8_t *) pvMem;
+
+#if (rmpSYNC_SCAN_SIMD_ENABLE == 1)
+    if (__builtin_cpu_supports("avx2") != 0) {
+        return (prvFindSyncWordAVX2(pMem, uLen, uFirstByte, uSecondByte));
+    }
+
+    return (prvFindSyncWordSSE2(pMem, uLen, uFirstByte, uSecondByte));
+#else
+    return (prvFindSyncWordScalar(pMem, uLen, uFirstByte, uSecondByte));
+#endif
+}
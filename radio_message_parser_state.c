@@ -33,8 +33,9 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "radio_message_parser.h"
-#include "lwrb.h"
+#include "radio_message_parser_ring.h"
 
 #if (rmpTEST_ENABLE != 1)
 rmpPRIVATE rmp_return_code
@@ -46,92 +47,281 @@ RMP_FindSecondByte(void *vObj, void *pDst, size_t uDstMemSize);
 rmpPRIVATE rmp_return_code
 RMP_WaitAndCopyMessage(void *vObj, void *pDst, size_t uDstMemSize);
 
+rmpPRIVATE rmp_return_code
+RMP_WaitAndCopyFrame(void *vObj, void *pDst, size_t uDstMemSize);
+
+rmpPRIVATE rmp_return_code
+RMP_ReadFrameLength(void *vObj, void *pDst, size_t uDstMemSize);
+
+rmpPRIVATE rmp_return_code
+RMP_WaitAndCopyLengthPrefixedFrame(
+    void  *vObj,
+    void  *pDst,
+    size_t uDstMemSize);
+
+rmpPRIVATE rmp_return_code
+RMP_FindAndCopyMessage(void *vObj, void *pDst, size_t uDstMemSize);
+
+rmpPRIVATE rmp_return_code
+RMP_FindAndCopyFrame(void *vObj, void *pDst, size_t uDstMemSize);
+
+    #if (rmpSTATE_ENGINE == rmpSTATE_ENGINE_SWITCH)
+rmpPRIVATE rmp_return_code
+RMP_RunStateSwitch(void *vObj, void *pDst, size_t uDstMemSize);
+    #else
+rmpPRIVATE rmp_return_code
+RMP_RunStateTable(void *vObj, void *pDst, size_t uDstMemSize);
+    #endif
+
 rmpPRIVATE size_t
 RMP_Get(void *vObj, void *pDst, size_t uDstMemSize);
 
 bool
 RMP_SetState(void *vObj, rmp_state_e eNewState);
 
-rmpPRIVATE uint16_t
-CORE_GetCrc16_CCITT_Poly0x1021(const void *pSrc, size_t uLen);
-
 rmpPRIVATE uint16_t
 RMP_GetPackCrc(void *pvMessage);
 #endif
 
+/**
+ * @brief Формат сообщения по умолчанию, известный во время компиляции.
+ */
+static const rmp_frame_desc_t xDefaultFrameDesc = rmpFRAME_DESC_DEFAULT;
+
+/**
+ * @brief Таблицы функций состояний, общие для всех экземпляров. Вариант
+ * таблицы выбирается в RMP_InitStateAPI() по формату сообщения и флагу
+ * объединенной обработки.
+ */
+static const rmp_state_api_t xStateAPIMessage = {
+    .aFn = {
+        [rmpSTATE_FIND_FIRST_BYTE]       = RMP_FindFirstByte,
+        [rmpSTATE_FIND_SECOND_BYTE]      = RMP_FindSecondByte,
+        [rmpSTATE_READ_LENGTH]           = RMP_ReadFrameLength,
+        [rmpSTATE_WAIT_AND_COPY_MESSAGE] = RMP_WaitAndCopyMessage,
+    }};
+
+static const rmp_state_api_t xStateAPIFrame = {
+    .aFn = {
+        [rmpSTATE_FIND_FIRST_BYTE]       = RMP_FindFirstByte,
+        [rmpSTATE_FIND_SECOND_BYTE]      = RMP_FindSecondByte,
+        [rmpSTATE_READ_LENGTH]           = RMP_ReadFrameLength,
+        [rmpSTATE_WAIT_AND_COPY_MESSAGE] = RMP_WaitAndCopyFrame,
+    }};
+
+static const rmp_state_api_t xStateAPIFastMessage = {
+    .aFn = {
+        [rmpSTATE_FIND_FIRST_BYTE]       = RMP_FindAndCopyMessage,
+        [rmpSTATE_FIND_SECOND_BYTE]      = RMP_FindSecondByte,
+        [rmpSTATE_READ_LENGTH]           = RMP_ReadFrameLength,
+        [rmpSTATE_WAIT_AND_COPY_MESSAGE] = RMP_WaitAndCopyMessage,
+    }};
+
+static const rmp_state_api_t xStateAPIFastFrame = {
+    .aFn = {
+        [rmpSTATE_FIND_FIRST_BYTE]       = RMP_FindAndCopyFrame,
+        [rmpSTATE_FIND_SECOND_BYTE]      = RMP_FindSecondByte,
+        [rmpSTATE_READ_LENGTH]           = RMP_ReadFrameLength,
+        [rmpSTATE_WAIT_AND_COPY_MESSAGE] = RMP_WaitAndCopyFrame,
+    }};
+
+static const rmp_state_api_t xStateAPILengthPrefixed = {
+    .aFn = {
+        [rmpSTATE_FIND_FIRST_BYTE]       = RMP_FindFirstByte,
+        [rmpSTATE_FIND_SECOND_BYTE]      = RMP_FindSecondByte,
+        [rmpSTATE_READ_LENGTH]           = RMP_ReadFrameLength,
+        [rmpSTATE_WAIT_AND_COPY_MESSAGE] = RMP_WaitAndCopyLengthPrefixedFrame,
+    }};
+
+static bool
+prvIsDefaultFrameDesc(const rmp_frame_desc_t *pxDesc)
+{
+    return (
+        (pxDesc->uSyncFirstByte == xDefaultFrameDesc.uSyncFirstByte)
+        && (pxDesc->uSyncSecondByte == xDefaultFrameDesc.uSyncSecondByte)
+        && (pxDesc->uFrameSizeInBytes == xDefaultFrameDesc.uFrameSizeInBytes)
+        && (pxDesc->uCrcOffset == xDefaultFrameDesc.uCrcOffset)
+        && (pxDesc->uCrcCoverageOffset == xDefaultFrameDesc.uCrcCoverageOffset)
+        && (pxDesc->uCrcCoverageSizeInBytes
+            == xDefaultFrameDesc.uCrcCoverageSizeInBytes)
+        && (pxDesc->bIsLengthPrefixed == xDefaultFrameDesc.bIsLengthPrefixed));
+}
+
+/**
+ * @brief Отбрасывает линейный блок, в котором не найдена пара байт начала
+ * сообщения. Последний байт блока остается считанным, но если он совпадает с
+ * первым байтом пары, то возвращается true и поиск продолжается со второго
+ * байта.
+ */
+static bool
+prvSkipSearchedBlock(
+    rmp_data_handle_t hObj,
+    const uint8_t    *pMem,
+    size_t            uLinearLen)
+{
+    /* Байт проверяется до освобождения блока, после которого в него может
+     * выполнить запись Put() */
+    bool bIsLastByteFirst =
+        (pMem[uLinearLen - 1u] == hObj->xFrameDesc.uSyncFirstByte);
+
+    RMP_Skip(hObj, uLinearLen);
+    rmpSTATS_ADD(
+        hObj,
+        uSkippedBytesNumb,
+        uLinearLen - (bIsLastByteFirst ? 1u : 0u));
+
+    return (bIsLastByteFirst);
+}
+
+/**
+ * @brief Проверяет контрольную сумму сообщения. Для формата, известного во
+ * время компиляции, расчет выполняется с постоянными смещением и размером.
+ */
+static __rmpFORCE_INLINE bool
+prvIsFrameCrcValid(const rmp_frame_desc_t *pxDesc, const uint8_t *pFrame)
+{
+    uint16_t uCrc = 0u;
+    memcpy(&uCrc, &pFrame[pxDesc->uCrcOffset], sizeof(uCrc));
+
+    return (
+        uCrc
+        == CORE_GetCrc16_CCITT_Poly0x1021(
+            &pFrame[pxDesc->uCrcCoverageOffset],
+            pxDesc->uCrcCoverageSizeInBytes));
+}
+
 rmp_state_api_handle_t
 RMP_InitStateAPI(void *vObj)
 {
-    rmp_data_handle_t hObj                         = (rmp_data_handle_t) vObj;
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    /* Вариант копирования сообщения выбирается один раз, поэтому формат
+     * сообщения, заданный во время выполнения, не добавляет проверок в
+     * обработку формата по умолчанию */
+    hObj->bIsDefaultFrameDesc = prvIsDefaultFrameDesc(&hObj->xFrameDesc);
+
+    if (hObj->xFrameDesc.bIsLengthPrefixed) {
+        hObj->pxStateAPI     = &xStateAPILengthPrefixed;
 
-    hObj->xStateAPI.aFn[rmpSTATE_FIND_FIRST_BYTE]  = RMP_FindFirstByte;
-    hObj->xStateAPI.aFn[rmpSTATE_FIND_SECOND_BYTE] = RMP_FindSecondByte;
+        /* Размер сообщения определяется байтом длины */
+        hObj->eSyncNextState = rmpSTATE_READ_LENGTH;
+    } else if (hObj->bIsFastPathEnabled) {
+        /* Сообщения, целиком записанные в буфер, извлекаются за один вызов
+         * из состояния поиска первого байта */
+        hObj->pxStateAPI     = hObj->bIsDefaultFrameDesc ? &xStateAPIFastMessage
+                                                         : &xStateAPIFastFrame;
+        hObj->eSyncNextState = rmpSTATE_WAIT_AND_COPY_MESSAGE;
+    } else {
+        hObj->pxStateAPI     = hObj->bIsDefaultFrameDesc ? &xStateAPIMessage
+                                                         : &xStateAPIFrame;
+        hObj->eSyncNextState = rmpSTATE_WAIT_AND_COPY_MESSAGE;
+    }
 
-    hObj->xStateAPI.aFn[rmpSTATE_WAIT_AND_COPY_MESSAGE] =
-        RMP_WaitAndCopyMessage;
+    hObj->uFrameSizeInBytes = hObj->xFrameDesc.uFrameSizeInBytes;
 
-    return (&hObj->xStateAPI);
+    return (hObj->pxStateAPI);
 }
 
-rmpPRIVATE rmp_return_code
-RMP_FindFirstByte(void *vObj, void *pDst, size_t uDstMemSize)
+/**
+ * @brief Функции состояний ниже возвращают следующее состояние конечного
+ * автомата, а код статуса записывают в <peReturnCode>. Состояние сохраняется
+ * в объекте вызывающей функцией: оболочками таблицы <pxStateAPI> после
+ * каждого вызова, а циклом switch один раз при выходе из обработки.
+ */
+static __rmpFORCE_INLINE rmp_state_e
+prvFindFirstByte(void *vObj, rmp_return_code *peReturnCode)
 {
-    (void) pDst;
-    (void) uDstMemSize;
+    rmp_data_handle_t hObj   = (rmp_data_handle_t) vObj;
+    rmp_state_e       eState = rmpSTATE_FIND_FIRST_BYTE;
 
-    rmp_data_handle_t hObj          = (rmp_data_handle_t) vObj;
-    size_t            uReadBytesCnt = 0u;
-    uint8_t           uOneByte;
+    *peReturnCode            = rmpBREAK;
 
-    rmp_return_code eReturnCode = rmpBREAK;
-
-    /* Циклический поиск байта начала сообщения */
+    /* Поиск пары байт начала сообщения выполняется сразу во всем линейном
+     * блоке кольцевого буфера. Данные в буфере могут располагаться в двух
+     * линейных блоках (до и после точки перехода через границу буфера),
+     * поэтому поиск выполняется циклически. Для зеркальной области памяти
+     * все данные расположены в одном блоке */
     while (1) {
-        /* Поиск первого байта начала пакета данных */
-        uOneByte = 0u;
-
-        size_t uReadBytesNumb =
-            lwrb_read(&hObj->xLWRB, &uOneByte, sizeof(uOneByte));
+        size_t         uLinearLen = 0u;
+        const uint8_t *pMem       = RMP_GetReadSpan(vObj, &uLinearLen);
 
-        uReadBytesCnt += uReadBytesNumb;
+        /* Поиск ограничен количеством байт, которое разрешено считать в
+         * текущем вызове обработчика */
+        if (uLinearLen > hObj->uReadBytesLeft) {
+            uLinearLen = hObj->uReadBytesLeft;
+        }
 
         /* В буфере нет байт, необходимо принудительно выйти из цикла */
-        if (uReadBytesNumb == 0u) {
+        if (uLinearLen == 0u) {
             break;
         }
         /*--------------------------------------------------------------------*/
 
-        /* Если обнаружен первый байт */
-        if (uOneByte == rmpSTART_FRAME_FIRST_BYTE) {
-            /* Переход в состояние поиска 2-го байта */
-            RMP_SetState(vObj, rmpSTATE_FIND_SECOND_BYTE);
+        size_t uSyncIdx = RMP_FindSyncWord(
+            pMem,
+            uLinearLen,
+            hObj->xFrameDesc.uSyncFirstByte,
+            hObj->xFrameDesc.uSyncSecondByte);
 
-            eReturnCode = rmpIN_PROGRESS;
+        /* Если обнаружены оба байта начала сообщения */
+        if (uSyncIdx < uLinearLen) {
+            /* Пропуск байт до конца пары байт начала сообщения одной
+             * операцией */
+            RMP_Skip(vObj, uSyncIdx + 2u);
+            rmpSTATS_ADD(hObj, uSkippedBytesNumb, uSyncIdx);
+
+            /* Переход в состояние ожидания сообщения (или чтения длины
+             * сообщения) */
+            eState        = hObj->eSyncNextState;
+
+            *peReturnCode = rmpIN_PROGRESS;
 
             break;
         }
-        /* if (uOneByte == rmpSTART_FRAME_FIRST_BYTE) */
+        /* if (uSyncIdx < uLinearLen) */
+
+        /* Пара байт не найдена, весь блок отбрасывается. Последний байт блока
+         * может быть первым байтом пары, второй байт которой находится после
+         * точки перехода или еще не записан */
+        if (prvSkipSearchedBlock(hObj, pMem, uLinearLen)) {
+            /* Переход в состояние поиска 2-го байта */
+            eState        = rmpSTATE_FIND_SECOND_BYTE;
+
+            *peReturnCode = rmpIN_PROGRESS;
 
-        /* Считано больше байт чем разрешено за один вызов Processing() */
-        if (uReadBytesNumb > hObj->uReadBytesThreshold) {
             break;
         }
     }
-    /* while (bIsFindFirstByte) */
+    /* while (1) */
 
-    return (eReturnCode);
+    return (eState);
 }
 
 rmpPRIVATE rmp_return_code
-RMP_FindSecondByte(void *vObj, void *pDst, size_t uDstMemSize)
+RMP_FindFirstByte(void *vObj, void *pDst, size_t uDstMemSize)
 {
     (void) pDst;
     (void) uDstMemSize;
 
-    uint8_t         uOneByte    = 0u;
-    rmp_return_code eReturnCode = rmpIN_PROGRESS;
+    rmp_return_code eReturnCode = rmpBREAK;
+    RMP_SetState(vObj, prvFindFirstByte(vObj, &eReturnCode));
 
-    size_t uReadBytesNumb       = RMP_Get(vObj, &uOneByte, sizeof(uOneByte));
+    return (eReturnCode);
+}
+
+static __rmpFORCE_INLINE rmp_state_e
+prvFindSecondByte(void *vObj, rmp_return_code *peReturnCode)
+{
+    rmp_data_handle_t hObj     = (rmp_data_handle_t) vObj;
+    uint8_t           uOneByte = 0u;
+    rmp_state_e       eState   = rmpSTATE_FIND_SECOND_BYTE;
+
+    *peReturnCode              = rmpIN_PROGRESS;
+
+    size_t uReadBytesNumb         = 0u;
+    if (hObj->uReadBytesLeft != 0u) {
+        uReadBytesNumb = RMP_Get(vObj, &uOneByte, sizeof(uOneByte));
+    }
 
     /* В буфер еще не записаны данные */
     if (uReadBytesNumb == 0) {
@@ -140,59 +330,496 @@ RMP_FindSecondByte(void *vObj, void *pDst, size_t uDstMemSize)
          * условие не означает что за первым байтом не следует второго, это
          * означает что пока в буфере нет данных и, при их получении, необходимо
          * повторить попытку чтения 2-го байта */
-        eReturnCode = rmpBREAK;
-    } else if (
-        (uReadBytesNumb == 1u) && (uOneByte == rmpSTART_FRAME_SECOND_BYTE)) {
-        RMP_SetState(vObj, rmpSTATE_WAIT_AND_COPY_MESSAGE);
+        *peReturnCode = rmpBREAK;
+    } else if (uOneByte == hObj->xFrameDesc.uSyncSecondByte) {
+        eState = hObj->eSyncNextState;
+    } else if (uOneByte == hObj->xFrameDesc.uSyncFirstByte) {
+        /* Повтор первого байта: он сам может быть началом сообщения, поэтому
+         * состояние поиска 2-го байта сохраняется */
+        rmpSTATS_ADD(hObj, uFalseFirstByteNumb, 1u);
+        rmpSTATS_ADD(hObj, uSkippedBytesNumb, 1u);
     } else {
-        RMP_SetState(vObj, rmpSTATE_FIND_FIRST_BYTE);
+        eState = rmpSTATE_FIND_FIRST_BYTE;
+
+        /* Отбрасываются ложный первый байт и считанный байт */
+        rmpSTATS_ADD(hObj, uFalseFirstByteNumb, 1u);
+        rmpSTATS_ADD(hObj, uSkippedBytesNumb, 2u);
     }
 
+    return (eState);
+}
+
+rmpPRIVATE rmp_return_code
+RMP_FindSecondByte(void *vObj, void *pDst, size_t uDstMemSize)
+{
+    (void) pDst;
+    (void) uDstMemSize;
+
+    rmp_return_code eReturnCode = rmpIN_PROGRESS;
+    RMP_SetState(vObj, prvFindSecondByte(vObj, &eReturnCode));
+
     return (eReturnCode);
 }
 
+static __rmpFORCE_INLINE rmp_state_e
+prvReadFrameLength(void *vObj, rmp_return_code *peReturnCode)
+{
+    rmp_data_handle_t hObj    = (rmp_data_handle_t) vObj;
+    uint8_t           uLength = 0u;
+    rmp_frame_desc_t  xDesc;
+
+    /* Байт длины не считывается из буфера: он входит в сообщение, копируется
+     * вместе с ним и учитывается при расчете контрольной суммы */
+    if (RMP_RingPeek(&hObj->xRing, 0u, &uLength, sizeof(uLength)) == 0u) {
+        *peReturnCode = rmpBREAK;
+
+        return (rmpSTATE_READ_LENGTH);
+    }
+
+    *peReturnCode = rmpIN_PROGRESS;
+
+    if (RMP_GetLengthPrefixedFrameDesc(&hObj->xFrameDesc, uLength, &xDesc)) {
+        hObj->uFrameSizeInBytes = xDesc.uFrameSizeInBytes;
+
+        return (rmpSTATE_WAIT_AND_COPY_MESSAGE);
+    }
+
+    /* Недопустимая длина, начало сообщения было ложным. Поиск продолжается
+     * с байта длины */
+    rmpSTATS_ADD(hObj, uLengthErrorsNumb, 1u);
+
+    return (rmpSTATE_FIND_FIRST_BYTE);
+}
+
 rmpPRIVATE rmp_return_code
-RMP_WaitAndCopyMessage(void *vObj, void *pDst, size_t uDstMemSize)
+RMP_ReadFrameLength(void *vObj, void *pDst, size_t uDstMemSize)
 {
-    rmp_data_handle_t      hObj        = (rmp_data_handle_t) vObj;
-    rmp_return_code        eReturnCode = rmpBREAK;
-    rmp_package_generic_t *pDstPack    = (rmp_package_generic_t *) pDst;
+    (void) pDst;
+    (void) uDstMemSize;
+
+    rmp_return_code eReturnCode = rmpIN_PROGRESS;
+    RMP_SetState(vObj, prvReadFrameLength(vObj, &eReturnCode));
+
+    return (eReturnCode);
+}
+
+/**
+ * @brief Копирует сообщение формата <pxDesc> из кольцевого буфера. Функция
+ * встраивается в варианты конечного автомата, поэтому для формата по
+ * умолчанию смещения и размеры являются константами времени компиляции.
+ */
+static __rmpFORCE_INLINE rmp_state_e
+prvWaitAndCopy(
+    void                   *vObj,
+    void                   *pDst,
+    size_t                  uDstMemSize,
+    const rmp_frame_desc_t *pxDesc,
+    rmp_return_code        *peReturnCode)
+{
+    rmp_data_handle_t hObj    = (rmp_data_handle_t) vObj;
+    rmp_state_e       eState  = rmpSTATE_WAIT_AND_COPY_MESSAGE;
+    uint8_t          *pDstMem = (uint8_t *) pDst;
+
+    *peReturnCode             = rmpBREAK;
+
+    const size_t uRestBytesNumb   = pxDesc->uFrameSizeInBytes - 2u;
 
     /* Если размер целевой области памяти больше или равен минимально
-     * допустимому размеру и в буфере находится необходимое количество байт */
-    if ((uDstMemSize >= sizeof(rmp_package_generic_t))
-        && (lwrb_get_full(&hObj->xLWRB)
-            >= (sizeof(rmp_package_generic_t) - sizeof(pDstPack->xHead)))) {
+     * допустимому размеру, в буфере находится необходимое количество байт и
+     * в текущем вызове обработчика еще разрешено чтение. Сообщение всегда
+     * считывается целиком, поэтому ограничение может быть превышено менее чем
+     * на размер одного сообщения */
+    if ((uDstMemSize >= pxDesc->uFrameSizeInBytes)
+        && RMP_RingHasFull(&hObj->xRing, uRestBytesNumb)
+        && (hObj->uReadBytesLeft != 0u)) {
         /* В буфере есть необходимое количество байт, требуется выполнить
          * копирование сообщения в целевую область памяти */
 
-        pDstPack->xHead.uFirstByte  = rmpSTART_FRAME_FIRST_BYTE;
-        pDstPack->xHead.uSecondByte = rmpSTART_FRAME_SECOND_BYTE;
-        RMP_Get(
-            vObj,
-            &pDstPack->xPLoad,
-            sizeof(pDstPack->xPLoad) + sizeof(pDstPack->uCrc));
+        pDstMem[0] = pxDesc->uSyncFirstByte;
+        pDstMem[1] = pxDesc->uSyncSecondByte;
+
+        /* Сообщение, расположенное в памяти непрерывно (всегда для
+         * зеркальной области памяти), копируется одной операцией */
+        size_t         uSpanLen = 0u;
+        const uint8_t *pSpan    = RMP_GetReadSpan(vObj, &uSpanLen);
+
+        if (uSpanLen >= uRestBytesNumb) {
+            memcpy((void *) &pDstMem[2], pSpan, uRestBytesNumb);
+        } else {
+            RMP_RingPeek(&hObj->xRing, 0u, &pDstMem[2], uRestBytesNumb);
+        }
+
+        /* В режиме восстановления синхронизации байты считываются только если
+         * контрольная сумма достоверна. Иначе начало сообщения было ложным и
+         * поиск продолжится с байта, следующего за ложным началом сообщения */
+        if (!hObj->bIsResyncOnCrcError) {
+            RMP_Skip(vObj, uRestBytesNumb);
+        }
 
         /* Сообщение найдено и скопировано, необходимо перейти в режим
          * поиска первого байта независимо от того достоверна контрольная сумма
          * или нет */
-        RMP_SetState(vObj, rmpSTATE_FIND_FIRST_BYTE);
+        eState = rmpSTATE_FIND_FIRST_BYTE;
+        /*--------------------------------------------------------------------*/
+
+        if (prvIsFrameCrcValid(pxDesc, pDstMem)) {
+            *peReturnCode = rmpMESSAGE_COPIED;
+            rmpSTATS_ADD(hObj, uDeliveredFramesNumb, 1u);
+
+            if (hObj->bIsResyncOnCrcError) {
+                RMP_Skip(vObj, uRestBytesNumb);
+            }
+
+            /* Сообщение целиком считано из буфера */
+            rmpTIMESTAMP_FRAME(
+                hObj,
+                hObj->uReadBytesCnt - pxDesc->uFrameSizeInBytes,
+                pxDesc->uFrameSizeInBytes);
+        } else {
+            *peReturnCode = rmpCRC_ERROR;
+            rmpSTATS_ADD(hObj, uCrcErrorsNumb, 1u);
+        }
+    }
+    /* if ((uDstMemSize >= pxDesc->uFrameSizeInBytes)
+        && RMP_RingHasFull(&hObj->xRing, uRestBytesNumb)
+        && (hObj->uReadBytesLeft != 0u)) */
+
+    return (eState);
+}
+
+rmpPRIVATE rmp_return_code
+RMP_WaitAndCopyMessage(void *vObj, void *pDst, size_t uDstMemSize)
+{
+    rmp_return_code eReturnCode = rmpBREAK;
+    RMP_SetState(
+        vObj,
+        prvWaitAndCopy(
+            vObj,
+            pDst,
+            uDstMemSize,
+            &xDefaultFrameDesc,
+            &eReturnCode));
+
+    return (eReturnCode);
+}
+
+rmpPRIVATE rmp_return_code
+RMP_WaitAndCopyFrame(void *vObj, void *pDst, size_t uDstMemSize)
+{
+    rmp_data_handle_t hObj        = (rmp_data_handle_t) vObj;
+    rmp_return_code   eReturnCode = rmpBREAK;
+    RMP_SetState(
+        vObj,
+        prvWaitAndCopy(
+            vObj,
+            pDst,
+            uDstMemSize,
+            &hObj->xFrameDesc,
+            &eReturnCode));
+
+    return (eReturnCode);
+}
+
+static __rmpFORCE_INLINE rmp_state_e
+prvWaitAndCopyLengthPrefixed(
+    void            *vObj,
+    void            *pDst,
+    size_t           uDstMemSize,
+    rmp_return_code *peReturnCode)
+{
+    rmp_data_handle_t hObj  = (rmp_data_handle_t) vObj;
+    rmp_frame_desc_t  xDesc = hObj->xFrameDesc;
+
+    /* Длина проверена в состоянии чтения длины сообщения */
+    RMP_GetLengthPrefixedFrameDesc(
+        &hObj->xFrameDesc,
+        hObj->uFrameSizeInBytes - 5u,
+        &xDesc);
+
+    return (prvWaitAndCopy(vObj, pDst, uDstMemSize, &xDesc, peReturnCode));
+}
+
+rmpPRIVATE rmp_return_code
+RMP_WaitAndCopyLengthPrefixedFrame(
+    void  *vObj,
+    void  *pDst,
+    size_t uDstMemSize)
+{
+    rmp_return_code eReturnCode = rmpBREAK;
+    RMP_SetState(
+        vObj,
+        prvWaitAndCopyLengthPrefixed(vObj, pDst, uDstMemSize, &eReturnCode));
+
+    return (eReturnCode);
+}
+
+/**
+ * @brief Состояние поиска первого байта с объединенной обработкой сообщения,
+ * целиком расположенного в линейном блоке кольцевого буфера: поиск пары байт
+ * начала сообщения, проверка контрольной суммы непосредственно в памяти
+ * буфера, копирование и чтение байт выполняются за один вызов, без переходов
+ * конечного автомата. Результат совпадает с последовательностью состояний
+ * поиска первого байта, второго байта и копирования сообщения.
+ *
+ * Если сообщение записано не полностью, разделено точкой перехода через
+ * границу буфера или до него исчерпано ограничение количества байт, то
+ * сообщение дочитывается конечным автоматом.
+ */
+static __rmpFORCE_INLINE rmp_state_e
+prvFindAndCopy(
+    void                   *vObj,
+    void                   *pDst,
+    size_t                  uDstMemSize,
+    const rmp_frame_desc_t *pxDesc,
+    rmp_return_code        *peReturnCode)
+{
+    rmp_data_handle_t hObj       = (rmp_data_handle_t) vObj;
+    const size_t      uFrameSize = pxDesc->uFrameSizeInBytes;
+
+    if (uDstMemSize < uFrameSize) {
+        return (prvFindFirstByte(vObj, peReturnCode));
+    }
+
+    while (1) {
+        size_t         uSpanLen   = 0u;
+        const uint8_t *pMem       = RMP_GetReadSpan(vObj, &uSpanLen);
+        size_t         uLinearLen = uSpanLen;
+
+        /* Поиск ограничен количеством байт, которое разрешено считать в
+         * текущем вызове обработчика */
+        if (uLinearLen > hObj->uReadBytesLeft) {
+            uLinearLen = hObj->uReadBytesLeft;
+        }
+
+        if (uLinearLen == 0u) {
+            *peReturnCode = rmpBREAK;
+
+            return (rmpSTATE_FIND_FIRST_BYTE);
+        }
         /*--------------------------------------------------------------------*/
 
-        if (RMP_IsCrcValid((void *) pDst)) {
-            eReturnCode = rmpMESSAGE_COPIED;
+        size_t uSyncIdx = RMP_FindSyncWord(
+            pMem,
+            uLinearLen,
+            pxDesc->uSyncFirstByte,
+            pxDesc->uSyncSecondByte);
+
+        if (uSyncIdx == uLinearLen) {
+            if (prvSkipSearchedBlock(hObj, pMem, uLinearLen)) {
+                *peReturnCode = rmpIN_PROGRESS;
+
+                return (rmpSTATE_FIND_SECOND_BYTE);
+            }
+
+            continue;
+        }
+
+        rmpSTATS_ADD(hObj, uSkippedBytesNumb, uSyncIdx);
+
+        /* Сообщение записано не полностью или разделено точкой перехода, либо
+         * после пары байт начала сообщения чтение уже не разрешено: как и в
+         * состоянии поиска первого байта, сообщение дочитывается конечным
+         * автоматом */
+        if (((uSpanLen - uSyncIdx) < uFrameSize)
+            || ((uSyncIdx + 2u) >= hObj->uReadBytesLeft)) {
+            RMP_Skip(vObj, uSyncIdx + 2u);
+            *peReturnCode = rmpIN_PROGRESS;
+
+            return (hObj->eSyncNextState);
+        }
+        /*--------------------------------------------------------------------*/
+
+        const uint8_t *pFrame = &pMem[uSyncIdx];
+
+        if (prvIsFrameCrcValid(pxDesc, pFrame)) {
+            memcpy(pDst, pFrame, uFrameSize);
+            RMP_Skip(vObj, uSyncIdx + uFrameSize);
+            rmpSTATS_ADD(hObj, uDeliveredFramesNumb, 1u);
+
+            rmpTIMESTAMP_FRAME(
+                hObj,
+                hObj->uReadBytesCnt - uFrameSize,
+                uFrameSize);
+
+            *peReturnCode = rmpMESSAGE_COPIED;
+
+            return (rmpSTATE_FIND_FIRST_BYTE);
         }
 
-        /* if (uCrc
-            == pDstIdx[rmpONE_MESSAGE_SIZE_IN_BYTES - rmpCRC_SIZE_IN_BYTES]) */
+        /* Как и в состоянии копирования сообщения: в режиме восстановления
+         * синхронизации поиск продолжится с байта, следующего за парой байт
+         * начала сообщения, иначе отбрасывается все сообщение */
+        RMP_Skip(
+            vObj,
+            uSyncIdx + (hObj->bIsResyncOnCrcError ? 2u : uFrameSize));
+        rmpSTATS_ADD(hObj, uCrcErrorsNumb, 1u);
+
+        *peReturnCode = rmpCRC_ERROR;
+
+        return (rmpSTATE_FIND_FIRST_BYTE);
     }
-    /** if ((uDstMemSize >= rmpONE_MESSAGE_SIZE_IN_BYTES)
-        && (lwrb_get_full(&hObj->xLWRB)
-            >= (rmpONE_MESSAGE_SIZE_IN_BYTES - sizeof(rmpSTART_FRAME)))) */
+    /* while (1) */
+}
+
+rmpPRIVATE rmp_return_code
+RMP_FindAndCopyMessage(void *vObj, void *pDst, size_t uDstMemSize)
+{
+    rmp_return_code eReturnCode = rmpBREAK;
+    RMP_SetState(
+        vObj,
+        prvFindAndCopy(
+            vObj,
+            pDst,
+            uDstMemSize,
+            &xDefaultFrameDesc,
+            &eReturnCode));
 
     return (eReturnCode);
 }
 
+rmpPRIVATE rmp_return_code
+RMP_FindAndCopyFrame(void *vObj, void *pDst, size_t uDstMemSize)
+{
+    rmp_data_handle_t hObj        = (rmp_data_handle_t) vObj;
+    rmp_return_code   eReturnCode = rmpBREAK;
+    RMP_SetState(
+        vObj,
+        prvFindAndCopy(
+            vObj,
+            pDst,
+            uDstMemSize,
+            &hObj->xFrameDesc,
+            &eReturnCode));
+
+    return (eReturnCode);
+}
+
+#if (rmpSTATE_ENGINE == rmpSTATE_ENGINE_TABLE) || (rmpTEST_ENABLE == 1)
+/**
+ * @brief Конечный автомат с вызовом функций состояний через таблицу
+ * <pxStateAPI>. Переходы выполняются до получения кода, отличного от
+ * <rmpIN_PROGRESS>.
+ */
+rmpPRIVATE rmp_return_code
+RMP_RunStateTable(void *vObj, void *pDst, size_t uDstMemSize)
+{
+    rmp_data_handle_t hObj        = (rmp_data_handle_t) vObj;
+    rmp_return_code   eReturnCode = rmpIN_PROGRESS;
+
+    do {
+        eReturnCode =
+            hObj->pxStateAPI->aFn[hObj->eState](vObj, pDst, uDstMemSize);
+    } while (eReturnCode == rmpIN_PROGRESS);
+
+    return (eReturnCode);
+}
+#endif
+
+#if (rmpSTATE_ENGINE == rmpSTATE_ENGINE_SWITCH) || (rmpTEST_ENABLE == 1)
+/**
+ * @brief Конечный автомат с выбором состояния оператором switch. Функции
+ * состояний встраиваются в один цикл без косвенных вызовов, для формата
+ * <pxDesc>, известного во время компиляции, смещения и размеры являются
+ * константами. Текущее состояние хранится в локальной переменной и
+ * сохраняется в объекте один раз при выходе из цикла, поэтому обработка
+ * продолжается при следующем вызове так же, как и для таблицы <pxStateAPI>.
+ */
+static __rmpFORCE_INLINE rmp_return_code
+prvRunStateSwitch(
+    void                   *vObj,
+    void                   *pDst,
+    size_t                  uDstMemSize,
+    const rmp_frame_desc_t *pxDesc)
+{
+    rmp_data_handle_t hObj        = (rmp_data_handle_t) vObj;
+    rmp_return_code   eReturnCode = rmpIN_PROGRESS;
+    rmp_state_e       eState      = hObj->eState;
+
+    /* Выбор вариантов состояний повторяет RMP_InitStateAPI() */
+    const bool bIsFastPath =
+        hObj->bIsFastPathEnabled && !pxDesc->bIsLengthPrefixed;
+
+    do {
+        switch (eState) {
+            case rmpSTATE_FIND_FIRST_BYTE:
+                eState = bIsFastPath ? prvFindAndCopy(
+                                           vObj,
+                                           pDst,
+                                           uDstMemSize,
+                                           pxDesc,
+                                           &eReturnCode)
+                                     : prvFindFirstByte(vObj, &eReturnCode);
+                break;
+
+            case rmpSTATE_FIND_SECOND_BYTE:
+                eState = prvFindSecondByte(vObj, &eReturnCode);
+                break;
+
+            case rmpSTATE_READ_LENGTH:
+                eState = prvReadFrameLength(vObj, &eReturnCode);
+                break;
+
+            case rmpSTATE_WAIT_AND_COPY_MESSAGE:
+                eState = pxDesc->bIsLengthPrefixed
+                             ? prvWaitAndCopyLengthPrefixed(
+                                   vObj,
+                                   pDst,
+                                   uDstMemSize,
+                                   &eReturnCode)
+                             : prvWaitAndCopy(
+                                   vObj,
+                                   pDst,
+                                   uDstMemSize,
+                                   pxDesc,
+                                   &eReturnCode);
+                break;
+
+            default:
+                eReturnCode = rmpBREAK;
+                break;
+        }
+        /* switch (eState) */
+    } while (eReturnCode == rmpIN_PROGRESS);
+
+    hObj->eState = eState;
+
+    return (eReturnCode);
+}
+
+rmpPRIVATE rmp_return_code
+RMP_RunStateSwitch(void *vObj, void *pDst, size_t uDstMemSize)
+{
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    if (hObj->bIsDefaultFrameDesc) {
+        return (prvRunStateSwitch(vObj, pDst, uDstMemSize, &xDefaultFrameDesc));
+    }
+
+    return (prvRunStateSwitch(vObj, pDst, uDstMemSize, &hObj->xFrameDesc));
+}
+#endif
+
+/**
+ * @brief Выполняет переходы конечного автомата до получения сообщения,
+ * недостоверной контрольной суммы или отсутствия данных. Реализация конечного
+ * автомата выбирается во время сборки (см. <rmpSTATE_ENGINE>).
+ *
+ * @param[out] vObj: Указатель на объект обработчика сообщений.
+ * @param[out] pDst: Целевая область памяти для копирования сообщения.
+ * @param[in] uDstMemSize: Размер целевой области памяти.
+ *
+ * @return Код, отличный от <rmpIN_PROGRESS>.
+ */
+rmp_return_code
+RMP_RunStateMachine(void *vObj, void *pDst, size_t uDstMemSize)
+{
+#if (rmpSTATE_ENGINE == rmpSTATE_ENGINE_SWITCH)
+    return (RMP_RunStateSwitch(vObj, pDst, uDstMemSize));
+#else
+    return (RMP_RunStateTable(vObj, pDst, uDstMemSize));
+#endif
+}
+
 rmpPRIVATE uint16_t
 RMP_GetPackCrc(void *pvMessage)
 {
@@ -240,12 +867,199 @@ RMP_IsCrcValid(void *pvMessage)
     return bIsCrcValid;
 }
 
+/**
+ * @brief Записывает контрольную сумму в сообщение формата <pxDesc>.
+ *
+ * @param[in] pxDesc: Формат сообщения.
+ * @param[in,out] pvFrame: Указатель на начало сообщения.
+ */
+void
+RMP_WriteFrameCrc(const rmp_frame_desc_t *pxDesc, void *pvFrame)
+{
+    uint8_t *pFrame = (uint8_t *) pvFrame;
+
+    uint16_t uCrc   = CORE_GetCrc16_CCITT_Poly0x1021(
+        &pFrame[pxDesc->uCrcCoverageOffset],
+        pxDesc->uCrcCoverageSizeInBytes);
+
+    memcpy(&pFrame[pxDesc->uCrcOffset], &uCrc, sizeof(uCrc));
+}
+
+/**
+ * @brief Проверяет достоверность контрольной суммы сообщения формата
+ * <pxDesc>.
+ *
+ * @param[in] pxDesc: Формат сообщения.
+ * @param[in] pvFrame: Указатель на начало сообщения.
+ *
+ * @return true в случае если контрольная сумма сообщения достоверна.
+ */
+bool
+RMP_IsFrameCrcValid(const rmp_frame_desc_t *pxDesc, const void *pvFrame)
+{
+    return (prvIsFrameCrcValid(pxDesc, (const uint8_t *) pvFrame));
+}
+
+/**
+ * @brief Формирует описание сообщения переменной длины с полезной нагрузкой
+ * размером <uPayloadSizeInBytes> (см. <rmp_frame_desc_t>). Полученное описание
+ * может быть передано в RMP_WriteFrameCrc() и RMP_IsFrameCrcValid().
+ *
+ * @param[in] pxDesc: Формат сообщения переменной длины.
+ * @param[in] uPayloadSizeInBytes: Длина полезной нагрузки.
+ * @param[out] pxFrameDesc: Описание сообщения.
+ *
+ * @return false, если длина полезной нагрузки недопустима.
+ */
+bool
+RMP_GetLengthPrefixedFrameDesc(
+    const rmp_frame_desc_t *pxDesc,
+    size_t                  uPayloadSizeInBytes,
+    rmp_frame_desc_t       *pxFrameDesc)
+{
+    /* Байты начала сообщения, байт длины и контрольная сумма */
+    const size_t uFrameSize = 5u + uPayloadSizeInBytes;
+
+    if ((uPayloadSizeInBytes < pxDesc->uMinPayloadSizeInBytes)
+        || (uFrameSize > pxDesc->uFrameSizeInBytes)) {
+        return (false);
+    }
+
+    *pxFrameDesc                   = *pxDesc;
+    pxFrameDesc->uFrameSizeInBytes = uFrameSize;
+    pxFrameDesc->uCrcOffset        = uFrameSize - sizeof(uint16_t);
+    pxFrameDesc->uCrcCoverageSizeInBytes =
+        pxFrameDesc->uCrcOffset - pxDesc->uCrcCoverageOffset;
+
+    return (true);
+}
+
+/**
+ * @brief Проверяет достоверность контрольных сумм группы пакетов данных,
+ * расположенных в памяти друг за другом (массив <rmp_package_generic_t>).
+ *
+ * @param[in] pvMessages: Указатель на первый пакет данных.
+ * @param[in] uMessagesNumb: Количество пакетов данных.
+ * @param[out] pbIsCrcValid: Массив из <uMessagesNumb> элементов для записи
+ * результата проверки каждого пакета (может быть NULL).
+ *
+ * @return Количество пакетов с достоверной контрольной суммой.
+ */
+size_t
+RMP_IsCrcValidMulti(
+    const void *pvMessages,
+    size_t      uMessagesNumb,
+    bool       *pbIsCrcValid)
+{
+    const rmp_package_generic_t *pPack =
+        (const rmp_package_generic_t *) pvMessages;
+
+    size_t   uValidNumb = 0u;
+    uint16_t uaCrc[16];
+
+    /* Расчет выполняется порциями, чтобы не требовать от пользователя
+     * выделения памяти под промежуточные значения CRC */
+    while (uMessagesNumb != 0u) {
+        size_t uPortion = uMessagesNumb;
+        if (uPortion > (sizeof(uaCrc) / sizeof(uaCrc[0]))) {
+            uPortion = sizeof(uaCrc) / sizeof(uaCrc[0]);
+        }
+
+        CORE_GetCrc16_CCITT_Poly0x1021_Multi(
+            &pPack->xPLoad,
+            sizeof(rmp_package_generic_t),
+            sizeof(pPack->xPLoad),
+            uPortion,
+            uaCrc);
+
+        for (size_t i = 0u; i < uPortion; ++i) {
+            bool bIsCrcValid = (pPack[i].uCrc == uaCrc[i]);
+
+            if (bIsCrcValid) {
+                uValidNumb++;
+            }
+
+            if (pbIsCrcValid != NULL) {
+                *pbIsCrcValid++ = bIsCrcValid;
+            }
+        }
+
+        pPack += uPortion;
+        uMessagesNumb -= uPortion;
+    }
+    /* while (uMessagesNumb != 0u) */
+
+    return (uValidNumb);
+}
+
+/**
+ * @brief Учитывает считанные из кольцевого буфера байты.
+ */
+static void
+prvCountReadBytes(rmp_data_handle_t hObj, size_t uBytesNumb)
+{
+    hObj->uReadBytesCnt += uBytesNumb;
+
+    if (uBytesNumb < hObj->uReadBytesLeft) {
+        hObj->uReadBytesLeft -= uBytesNumb;
+    } else {
+        hObj->uReadBytesLeft = 0u;
+    }
+}
+
 rmpPRIVATE size_t
 RMP_Get(void *vObj, void *pDst, size_t uDstMemSize)
 {
     rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
 
-    return (lwrb_read(&hObj->xLWRB, pDst, uDstMemSize));
+    size_t uReadBytesNumb  = RMP_RingRead(&hObj->xRing, pDst, uDstMemSize);
+    prvCountReadBytes(hObj, uReadBytesNumb);
+
+    return (uReadBytesNumb);
+}
+
+/**
+ * @brief Возвращает адрес первого непрочитанного байта кольцевого буфера и
+ * количество непрочитанных байт, расположенных в памяти непрерывно. Для
+ * зеркальной области памяти (см. <rmp_init_t>) непрерывно расположены все
+ * непрочитанные байты. При реализации кольцевого буфера SPSC количество
+ * определяется по копии позиции записи и может быть меньше записанных байт,
+ * но не равно 0, если байты записаны (см. RMP_RingHasFull()).
+ *
+ * @param[out] vObj: Указатель на объект обработчика сообщений.
+ * @param[out] puSpanLen: Количество байт, расположенных непрерывно.
+ *
+ * @return Адрес первого непрочитанного байта.
+ */
+const uint8_t *
+RMP_GetReadSpan(void *vObj, size_t *puSpanLen)
+{
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+    rmp_ring_t       *pRb  = &hObj->xRing;
+
+    *puSpanLen = hObj->bIsMirroredMem ? RMP_RingGetFullCached(pRb, 1u)
+                                      : RMP_RingGetReadLength(pRb);
+
+    return (RMP_RingGetReadAddress(pRb));
+}
+
+/**
+ * @brief Отбрасывает байты из кольцевого буфера без копирования.
+ *
+ * @param[out] vObj: Указатель на объект обработчика сообщений.
+ * @param[in] uBytesNumb: Количество отбрасываемых байт.
+ *
+ * @return Количество отброшенных байт.
+ */
+size_t
+RMP_Skip(void *vObj, size_t uBytesNumb)
+{
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    size_t uSkippedBytesNumb = RMP_RingSkip(&hObj->xRing, uBytesNumb);
+    prvCountReadBytes(hObj, uSkippedBytesNumb);
+
+    return (uSkippedBytesNumb);
 }
 
 bool
@@ -273,33 +1087,107 @@ RMP_GetState(void *vObj)
     return (hObj->eState);
 }
 
+rmp_stop_reason_e
+RMP_GetStopReason(void *vObj)
+{
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+
+    return (hObj->eStopReason);
+}
+
 /**
- * @brief Функция выполняет расчет 16-ти битной контрольной суммы.
- *
- * @see
- * https://ru.wikibooks.org/wiki/%D0%A0%D0%B5%D0%B0%D0%BB%D0%B8%D0%B7%D0%B0%D1%86%D0%B8%D0%B8_%D0%B0%D0%BB%D0%B3%D0%BE%D1%80%D0%B8%D1%82%D0%BC%D0%BE%D0%B2/%D0%A6%D0%B8%D0%BA%D0%BB%D0%B8%D1%87%D0%B5%D1%81%D0%BA%D0%B8%D0%B9_%D0%B8%D0%B7%D0%B1%D1%8B%D1%82%D0%BE%D1%87%D0%BD%D1%8B%D0%B9_%D0%BA%D0%BE%D0%B4#CRC-16
+ * @brief Регистрирует обработчик сообщений типа <uType>, вызываемый
+ * Dispatch().
  *
- * @param[in] pSrc: Адрес области памяти, с которой начинается вычисление CRC.
- * @param[in] uLen: Количество байт, участвующих в расчете CRC.
+ * @param[out] vObj: Указатель на объект обработчика сообщений.
+ * @param[in] uType: Значение байта типа сообщения.
+ * @param[in] pfnHandler: Обработчик сообщения (NULL - отмена регистрации).
+ * @param[in] pvCtx: Пользовательский контекст, передаваемый обработчику.
  *
- * @return Значение 16-ти битной контрольной суммы.
+ * @return false, если таблица обработчиков не задана при вызове RMP_Ctor().
  */
-rmpPRIVATE uint16_t
-CORE_GetCrc16_CCITT_Poly0x1021(const void *pSrc, size_t uLen)
+bool
+RMP_SetFrameHandler(
+    void               *vObj,
+    uint8_t             uType,
+    rmp_frame_handler_t pfnHandler,
+    void               *pvCtx)
 {
-    uint8_t *pMem = (uint8_t *) pSrc;
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
 
-    uint16_t uCrc = 0xFFFF;
+    if (hObj->pxDispatchTable == NULL) {
+        return (false);
+    }
 
-    while (uLen--) {
-        uCrc ^= (uint16_t) (*pMem++ << 8u);
-        size_t i;
-        for (i = 0; i < 8; i++) {
-            uCrc =
-                (uint16_t) (uCrc & 0x8000 ? (uCrc << 1) ^ 0x1021 : uCrc << 1);
-        }
+    hObj->pxDispatchTable[uType].pfnHandler = pfnHandler;
+    hObj->pxDispatchTable[uType].pvCtx      = pvCtx;
+
+    return (true);
+}
+
+bool
+RMP_GetStatsAndReset(void *vObj, rmp_stats_t *pxStats)
+{
+    if (pxStats == NULL) {
+        return (false);
     }
-    /* while (uLen--) */
 
-    return (uCrc);
+    memset((void *) pxStats, 0, sizeof(rmp_stats_t));
+
+#if (rmpSTATS_ENABLE == 1)
+    rmp_data_handle_t hObj = (rmp_data_handle_t) vObj;
+    rmp_stats_cnt_t  *pCnt = &hObj->xStats;
+
+    /* Каждый счетчик считывается и обнуляется одной атомарной операцией,
+     * поэтому ни одно событие не теряется. Счетчики считываются
+     * последовательно, т.е. снимок не согласован между счетчиками */
+    pxStats->uIngestedBytesNumb = atomic_exchange_explicit(
+        &pCnt->uIngestedBytesNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uRejectedBytesNumb = atomic_exchange_explicit(
+        &pCnt->uRejectedBytesNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uDiscardedBytesNumb = atomic_exchange_explicit(
+        &pCnt->uDiscardedBytesNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uDroppedFramesNumb = atomic_exchange_explicit(
+        &pCnt->uDroppedFramesNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uSkippedBytesNumb = atomic_exchange_explicit(
+        &pCnt->uSkippedBytesNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uFalseFirstByteNumb = atomic_exchange_explicit(
+        &pCnt->uFalseFirstByteNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uCrcErrorsNumb = atomic_exchange_explicit(
+        &pCnt->uCrcErrorsNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uLengthErrorsNumb = atomic_exchange_explicit(
+        &pCnt->uLengthErrorsNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uDeliveredFramesNumb = atomic_exchange_explicit(
+        &pCnt->uDeliveredFramesNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uUnhandledFramesNumb = atomic_exchange_explicit(
+        &pCnt->uUnhandledFramesNumb,
+        0u,
+        memory_order_relaxed);
+    pxStats->uResetsNumb =
+        atomic_exchange_explicit(&pCnt->uResetsNumb, 0u, memory_order_relaxed);
+
+    return (true);
+#else
+    (void) vObj;
+
+    return (false);
+#endif
 }
@@ -0,0 +1,441 @@
+/**
+ * @file rmp_channel_sim.c
+ * @author Mickle Isaev (mrraptor26@gmail.com)
+ *
+ * @brief Имитатор радиоканала для воспроизводимой генерации входного потока
+ * RMP.
+ *
+ * Более подробное описание вы можете найти в <rmp_channel_sim.h>.
+ *
+ * @copyright Copyright (c) 2024 StilSoft
+ */
+
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+#include "rmp_channel_sim.h"
+
+/**
+ * @brief Размер фрагмента потока, формируемого RMP_ChannelSimRun() до начала
+ * замера времени, и максимальное количество блоков записи в нем.
+ */
+#define rmpSIM_RUN_BATCH_SIZE_IN_BYTES (16u * 1024u)
+#define rmpSIM_RUN_BATCH_CHUNKS_NUMB   (1024u)
+
+static uint64_t
+prvRand(rmp_channel_sim_t *pxSim);
+
+static double
+prvRandUnit(rmp_channel_sim_t *pxSim);
+
+static uint64_t
+prvGetEventDistance(rmp_channel_sim_t *pxSim, double dRate);
+
+static void
+prvMakeUnit(rmp_channel_sim_t *pxSim);
+
+static size_t
+prvGenerate(
+    rmp_channel_sim_t *pxSim,
+    uint8_t           *pDst,
+    size_t             uLen,
+    size_t             uMaxFramesNumb);
+
+static uint64_t
+prvGetCpuTimeNs(void);
+
+/**
+ * @brief Выполняет сброс параметров модели канала в параметры <по умолчанию>:
+ * канал без искажений, сообщения без промежутков, блоки записи по 64 байта.
+ *
+ * @param[out] pxInit: Указатель на структуру параметров модели канала.
+ */
+void
+RMP_ChannelSimStructInit(rmp_channel_sim_init_t *pxInit)
+{
+    memset((void *) pxInit, 0, sizeof(rmp_channel_sim_init_t));
+
+    pxInit->uSeed             = 0x12345678u;
+    pxInit->uFrameType        = 0x05u;
+    pxInit->uChunkSizeInBytes = 64u;
+}
+
+/**
+ * @brief Инициализирует имитатор канала.
+ *
+ * @param[out] pxSim: Указатель на состояние имитатора канала.
+ * @param[in] pxInit: Указатель на параметры модели канала.
+ *
+ * @return false, если параметры недопустимы.
+ */
+bool
+RMP_ChannelSimInit(
+    rmp_channel_sim_t            *pxSim,
+    const rmp_channel_sim_init_t *pxInit)
+{
+    if ((pxSim == NULL) || (pxInit == NULL)) {
+        return (false);
+    }
+
+    if ((pxInit->uSeed == 0u)
+        || (pxInit->uGapMaxSizeInBytes > rmpSIM_GAP_MAX_SIZE_IN_BYTES)
+        || (pxInit->dRateJitter < 0.0) || (pxInit->dRateJitter > 1.0)) {
+        return (false);
+    }
+
+    if ((pxInit->dOutageRate > 0.0) && (pxInit->uOutageMaxSizeInBytes == 0u)) {
+        return (false);
+    }
+
+    memset((void *) pxSim, 0, sizeof(rmp_channel_sim_t));
+
+    pxSim->xInit            = *pxInit;
+    pxSim->uRandState       = pxInit->uSeed;
+    pxSim->uBitsToNextError = prvGetEventDistance(pxSim, pxInit->dBitErrorRate);
+    pxSim->uBytesToNextDrop = prvGetEventDistance(pxSim, pxInit->dByteDropRate);
+
+    return (true);
+}
+
+/**
+ * @brief Формирует следующие <uLen> байт потока на выходе канала. Поток
+ * непрерывен между вызовами, сообщение может быть разделено между ними.
+ *
+ * @param[out] pxSim: Указатель на состояние имитатора канала.
+ * @param[out] pDst: Область памяти для записи потока.
+ * @param[in] uLen: Количество байт потока.
+ *
+ * @return Количество записанных байт (равно <uLen>).
+ */
+size_t
+RMP_ChannelSimGenerate(rmp_channel_sim_t *pxSim, void *pDst, size_t uLen)
+{
+    return (prvGenerate(pxSim, (uint8_t *) pDst, uLen, SIZE_MAX));
+}
+
+/**
+ * @brief Возвращает размер следующего блока записи в кольцевой буфер с учетом
+ * неравномерности скорости поступления байт (не менее 1 байта).
+ */
+size_t
+RMP_ChannelSimNextChunkSize(rmp_channel_sim_t *pxSim)
+{
+    const double dMean =
+        (pxSim->xInit.uChunkSizeInBytes != 0u)
+            ? (double) pxSim->xInit.uChunkSizeInBytes
+            : 1.0;
+
+    if (pxSim->xInit.dRateJitter <= 0.0) {
+        return ((size_t) dMean);
+    }
+
+    const double dDeviation = 2.0 * prvRandUnit(pxSim) - 1.0;
+    const double dSize = dMean * (1.0 + pxSim->xInit.dRateJitter * dDeviation);
+
+    return ((dSize < 1.5) ? 1u : (size_t) (dSize + 0.5));
+}
+
+/**
+ * @brief Передает <uFramesNumb> сообщений через модель канала в обработчик
+ * сообщений: поток записывается Put() блоками RMP_ChannelSimNextChunkSize(),
+ * после каждого блока сообщения извлекаются ProcessingBatch().
+ *
+ * Поток формируется фрагментами до начала замера времени, поэтому в
+ * <uCpuNs> учитывается только время обработчика сообщений. Полученное
+ * сообщение считается отправленным, если его номер больше номера предыдущего
+ * полученного сообщения и не превышает номер последнего отправленного.
+ *
+ * @param[out] pxSim: Указатель на состояние имитатора канала.
+ * @param[in] hAPI: Обработчик сообщений формата <rmpFRAME_DESC_DEFAULT>.
+ * @param[in] uFramesNumb: Количество отправляемых сообщений.
+ * @param[out] pxResult: Результат передачи.
+ *
+ * @return false, если параметры недопустимы или кольцевой буфер меньше
+ * размера сообщения.
+ */
+bool
+RMP_ChannelSimRun(
+    rmp_channel_sim_t        *pxSim,
+    rmp_api_handle_t          hAPI,
+    size_t                    uFramesNumb,
+    rmp_channel_sim_result_t *pxResult)
+{
+    if ((pxSim == NULL) || (hAPI == NULL) || (pxResult == NULL)) {
+        return (false);
+    }
+
+    memset((void *) pxResult, 0, sizeof(rmp_channel_sim_result_t));
+
+    static uint8_t        uaBatch[rmpSIM_RUN_BATCH_SIZE_IN_BYTES];
+    static size_t         uaChunkSize[rmpSIM_RUN_BATCH_CHUNKS_NUMB];
+    rmp_package_generic_t xaFrames[32];
+
+    const size_t uFirstSeq      = pxSim->uSentFramesNumb;
+    const size_t uMaxFramesNumb = uFirstSeq + uFramesNumb;
+    size_t       uNextSeq       = uFirstSeq;
+
+    while (1) {
+        /* Формирование фрагмента потока */
+        size_t uChunksNumb = 0u;
+        size_t uBatchLen   = 0u;
+
+        while ((uChunksNumb < rmpSIM_RUN_BATCH_CHUNKS_NUMB)
+               && (uBatchLen < sizeof(uaBatch))) {
+            size_t uChunk = RMP_ChannelSimNextChunkSize(pxSim);
+            if (uChunk > (sizeof(uaBatch) - uBatchLen)) {
+                uChunk = sizeof(uaBatch) - uBatchLen;
+            }
+
+            uChunk =
+                prvGenerate(pxSim, &uaBatch[uBatchLen], uChunk, uMaxFramesNumb);
+            if (uChunk == 0u) {
+                break;
+            }
+
+            uaChunkSize[uChunksNumb++]  = uChunk;
+            uBatchLen                  += uChunk;
+        }
+
+        if (uChunksNumb == 0u) {
+            break;
+        }
+        /*--------------------------------------------------------------------*/
+
+        uint64_t uStartNs = prvGetCpuTimeNs();
+        size_t   uPos     = 0u;
+
+        for (size_t i = 0u; i < uChunksNumb; ++i) {
+            const size_t uChunkEnd = uPos + uaChunkSize[i];
+
+            while (uPos < uChunkEnd) {
+                size_t uWritten =
+                    hAPI->Put(hAPI, &uaBatch[uPos], uChunkEnd - uPos);
+                size_t uNumb    = 0u;
+                size_t uDrained = 0u;
+
+                uPos           += uWritten;
+
+                do {
+                    uNumb = hAPI->ProcessingBatch(
+                        hAPI,
+                        xaFrames,
+                        sizeof(xaFrames) / sizeof(xaFrames[0]),
+                        0u,
+                        NULL);
+
+                    for (size_t j = 0u; j < uNumb; ++j) {
+                        uint32_t uSeq = 0u;
+                        memcpy(
+                            &uSeq,
+                            (const uint8_t *) &xaFrames[j] + rmpSIM_SEQ_OFFSET,
+                            sizeof(uSeq));
+
+                        if ((uSeq >= uNextSeq)
+                            && (uSeq < pxSim->uSentFramesNumb)) {
+                            pxResult->uRecoveredFramesNumb++;
+                            uNextSeq = (size_t) uSeq + 1u;
+                        } else {
+                            pxResult->uFalseFramesNumb++;
+                        }
+                    }
+
+                    uDrained += uNumb;
+                } while (uNumb != 0u);
+
+                /* Кольцевой буфер заполнен байтами незавершенного сообщения */
+                if ((uWritten == 0u) && (uDrained == 0u)) {
+                    return (false);
+                }
+            }
+        }
+
+        pxResult->uCpuNs += prvGetCpuTimeNs() - uStartNs;
+        pxResult->uStreamBytesNumb += uBatchLen;
+    }
+    /* while (1) */
+
+    pxResult->uSentFramesNumb = pxSim->uSentFramesNumb - uFirstSeq;
+
+    return (true);
+}
+
+static uint64_t
+prvRand(rmp_channel_sim_t *pxSim)
+{
+    /* xorshift64* */
+    uint64_t uX = pxSim->uRandState;
+    uX ^= uX >> 12u;
+    uX ^= uX << 25u;
+    uX ^= uX >> 27u;
+    pxSim->uRandState = uX;
+
+    return (uX * 0x2545F4914F6CDD1DULL);
+}
+
+/**
+ * @brief Возвращает случайное число, равномерно распределенное в (0, 1].
+ */
+static double
+prvRandUnit(rmp_channel_sim_t *pxSim)
+{
+    return (((double) (prvRand(pxSim) >> 11u) + 1.0) / 9007199254740992.0);
+}
+
+/**
+ * @brief Возвращает количество испытаний до следующего события с вероятностью
+ * <dRate> (геометрическое распределение).
+ */
+static uint64_t
+prvGetEventDistance(rmp_channel_sim_t *pxSim, double dRate)
+{
+    if (dRate <= 0.0) {
+        return (UINT64_MAX);
+    }
+
+    if (dRate >= 1.0) {
+        return (0u);
+    }
+
+    double dDistance = floor(log(prvRandUnit(pxSim)) / log1p(-dRate));
+
+    return ((dDistance >= 1.8e19) ? UINT64_MAX : (uint64_t) dDistance);
+}
+
+/**
+ * @brief Формирует фрагмент потока из промежутка случайных байт и очередного
+ * сообщения и искажает его моделью канала.
+ */
+static void
+prvMakeUnit(rmp_channel_sim_t *pxSim)
+{
+    const rmp_channel_sim_init_t *pxInit = &pxSim->xInit;
+    uint8_t                      *pUnit  = pxSim->uaUnit;
+
+    size_t uGapLen                       = 0u;
+    if (pxInit->uGapMaxSizeInBytes != 0u) {
+        uGapLen = prvRand(pxSim) % (pxInit->uGapMaxSizeInBytes + 1u);
+    }
+
+    for (size_t i = 0u; i < uGapLen; ++i) {
+        pUnit[i] = (uint8_t) prvRand(pxSim);
+    }
+    /*------------------------------------------------------------------------*/
+
+    rmp_package_generic_t *pPack = (rmp_package_generic_t *) &pUnit[uGapLen];
+    pPack->xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+    pPack->xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+    for (size_t i = 0u; i < sizeof(pPack->xPLoad.uDummy); ++i) {
+        pPack->xPLoad.uDummy[i] = (uint8_t) prvRand(pxSim);
+    }
+
+    uint32_t uSeq = (uint32_t) pxSim->uSentFramesNumb;
+    pPack->xPLoad.uDummy[0] = pxInit->uFrameType;
+    memcpy(&pUnit[uGapLen + rmpSIM_SEQ_OFFSET], &uSeq, sizeof(uSeq));
+
+    RPM_WriteCrcInMessageTail((void *) pPack);
+
+    pxSim->uSentFramesNumb++;
+
+    const size_t uLen = uGapLen + sizeof(rmp_package_generic_t);
+    /*------------------------------------------------------------------------*/
+
+    /* Инверсия бит */
+    const uint64_t uBitsNumb = (uint64_t) uLen * 8u;
+    uint64_t       uBitPos   = 0u;
+
+    while (pxSim->uBitsToNextError < (uBitsNumb - uBitPos)) {
+        uBitPos += pxSim->uBitsToNextError;
+        pUnit[uBitPos / 8u] ^= (uint8_t) (1u << (uBitPos % 8u));
+        uBitPos++;
+
+        pxSim->uBitsToNextError =
+            prvGetEventDistance(pxSim, pxInit->dBitErrorRate);
+    }
+    pxSim->uBitsToNextError -= uBitsNumb - uBitPos;
+    /*------------------------------------------------------------------------*/
+
+    /* Пропадание связи начинается с промежутка перед сообщением */
+    if ((pxInit->dOutageRate > 0.0)
+        && (prvRandUnit(pxSim) <= pxInit->dOutageRate)) {
+        pxSim->uOutageBytesLeft +=
+            1u + (size_t) (prvRand(pxSim) % pxInit->uOutageMaxSizeInBytes);
+    }
+
+    size_t uIn  = (pxSim->uOutageBytesLeft < uLen) ? pxSim->uOutageBytesLeft
+                                                   : uLen;
+    size_t uOut = 0u;
+
+    pxSim->uOutageBytesLeft -= uIn;
+
+    /* Потеря отдельных байт */
+    while (uIn < uLen) {
+        size_t uSpan = uLen - uIn;
+        if (pxSim->uBytesToNextDrop < uSpan) {
+            uSpan = (size_t) pxSim->uBytesToNextDrop;
+        }
+
+        memmove(&pUnit[uOut], &pUnit[uIn], uSpan);
+        uOut                    += uSpan;
+        uIn                     += uSpan;
+        pxSim->uBytesToNextDrop -= uSpan;
+
+        if (uIn < uLen) {
+            uIn++;
+            pxSim->uBytesToNextDrop =
+                prvGetEventDistance(pxSim, pxInit->dByteDropRate);
+        }
+    }
+
+    pxSim->uUnitLen = uOut;
+    pxSim->uUnitPos = 0u;
+}
+
+/**
+ * @brief Формирует не более <uLen> байт потока. Новые сообщения не
+ * формируются после отправки <uMaxFramesNumb> сообщений.
+ */
+static size_t
+prvGenerate(
+    rmp_channel_sim_t *pxSim,
+    uint8_t           *pDst,
+    size_t             uLen,
+    size_t             uMaxFramesNumb)
+{
+    size_t uPos = 0u;
+
+    while (uPos < uLen) {
+        if (pxSim->uUnitPos == pxSim->uUnitLen) {
+            if (pxSim->uSentFramesNumb >= uMaxFramesNumb) {
+                break;
+            }
+
+            /* Фрагмент может оказаться пустым из-за потери байт */
+            prvMakeUnit(pxSim);
+
+            continue;
+        }
+
+        size_t uSpan = pxSim->uUnitLen - pxSim->uUnitPos;
+        if (uSpan > (uLen - uPos)) {
+            uSpan = uLen - uPos;
+        }
+
+        memcpy(&pDst[uPos], &pxSim->uaUnit[pxSim->uUnitPos], uSpan);
+        pxSim->uUnitPos += uSpan;
+        uPos            += uSpan;
+    }
+
+    pxSim->uStreamBytesNumb += uPos;
+
+    return (uPos);
+}
+
+static uint64_t
+prvGetCpuTimeNs(void)
+{
+    struct timespec xTime;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &xTime);
+
+    return ((uint64_t) xTime.tv_sec * 1000000000u + (uint64_t) xTime.tv_nsec);
+}
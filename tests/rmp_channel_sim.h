@@ -0,0 +1,193 @@
+/**
+ * @file rmp_channel_sim.h
+ * @author Mickle Isaev (mrraptor26@gmail.com)
+ *
+ * @brief Имитатор радиоканала для воспроизводимой генерации входного потока
+ * RMP. Сообщения <rmp_package_generic_t> кодируются RPM_WriteCrcInMessageTail()
+ * и искажаются моделью канала:
+ *
+ *      - случайные байты между сообщениями;
+ *
+ *      - инверсия бит с заданной вероятностью на бит;
+ *
+ *      - потеря отдельных байт с заданной вероятностью на байт;
+ *
+ *      - пропадание связи: потеря нескольких байт подряд;
+ *
+ *      - неравномерная скорость поступления байт (размер блока записи).
+ *
+ * Генератор детерминирован: при одинаковых параметрах и <uSeed> формируется
+ * один и тот же поток. События канала разыгрываются по расстоянию до
+ * следующего события (геометрическое распределение), а не для каждого бита,
+ * поэтому генерация не ограничивает скорость замеров.
+ *
+ * Номер сообщения записывается в полезную нагрузку, что позволяет отличить
+ * отправленное сообщение от ложного сообщения с достоверной контрольной
+ * суммой.
+ *
+ * @copyright Copyright (c) 2024 StilSoft
+ */
+
+#ifndef RMP_CHANNEL_SIM_H
+#define RMP_CHANNEL_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "radio_message_parser.h"
+
+/**
+ * @brief Максимальная длина промежутка между сообщениями.
+ */
+#define rmpSIM_GAP_MAX_SIZE_IN_BYTES (64u)
+
+/**
+ * @brief Смещение номера сообщения (4 байта, порядок байт платформы) в
+ * сообщении. Первый байт полезной нагрузки занят типом сообщения.
+ */
+#define rmpSIM_SEQ_OFFSET (offsetof(rmp_package_generic_t, xPLoad) + 4u)
+
+/**
+ * @brief Параметры модели канала.
+ */
+typedef struct
+{
+    /**
+     * @brief Начальное значение генератора псевдослучайных чисел (не 0).
+     */
+    uint32_t uSeed;
+
+    /**
+     * @brief Тип сообщения (первый байт полезной нагрузки).
+     */
+    uint8_t uFrameType;
+
+    /**
+     * @brief Максимальная длина промежутка случайных байт между сообщениями
+     * (длина равномерно распределена от 0, не более
+     * <rmpSIM_GAP_MAX_SIZE_IN_BYTES>).
+     */
+    size_t uGapMaxSizeInBytes;
+
+    /**
+     * @brief Вероятность инверсии бита.
+     */
+    double dBitErrorRate;
+
+    /**
+     * @brief Вероятность потери байта.
+     */
+    double dByteDropRate;
+
+    /**
+     * @brief Вероятность пропадания связи на каждое отправленное сообщение и
+     * максимальная длительность пропадания в байтах (длительность равномерно
+     * распределена от 1).
+     */
+    double dOutageRate;
+    size_t uOutageMaxSizeInBytes;
+
+    /**
+     * @brief Средний размер блока, записываемого в кольцевой буфер, и
+     * относительное отклонение размера блока (0 - блоки одинакового размера,
+     * 1 - от 1 до удвоенного среднего размера).
+     */
+    size_t uChunkSizeInBytes;
+    double dRateJitter;
+} rmp_channel_sim_init_t;
+
+/**
+ * @brief Состояние имитатора канала.
+ */
+typedef struct
+{
+    rmp_channel_sim_init_t xInit;
+
+    uint64_t uRandState;
+
+    /**
+     * @brief Количество отправленных сообщений (номер следующего сообщения).
+     */
+    size_t uSentFramesNumb;
+
+    /**
+     * @brief Количество сформированных байт потока.
+     */
+    size_t uStreamBytesNumb;
+
+    /**
+     * @brief Расстояние до следующей инверсии бита (в битах) и до следующей
+     * потери байта (в байтах), а также количество байт, которые еще будут
+     * потеряны из-за пропадания связи.
+     */
+    uint64_t uBitsToNextError;
+    uint64_t uBytesToNextDrop;
+    size_t   uOutageBytesLeft;
+
+    /**
+     * @brief Сформированный, но еще не выданный фрагмент потока (промежуток и
+     * сообщение после искажения каналом).
+     */
+    uint8_t
+        uaUnit[rmpSIM_GAP_MAX_SIZE_IN_BYTES + sizeof(rmp_package_generic_t)];
+    size_t uUnitLen;
+    size_t uUnitPos;
+} rmp_channel_sim_t;
+
+/**
+ * @brief Результат передачи сообщений через модель канала в обработчик
+ * сообщений (см. RMP_ChannelSimRun()).
+ */
+typedef struct
+{
+    /**
+     * @brief Количество отправленных сообщений.
+     */
+    size_t uSentFramesNumb;
+
+    /**
+     * @brief Количество полученных отправленных сообщений (без искажений и
+     * повторов).
+     */
+    size_t uRecoveredFramesNumb;
+
+    /**
+     * @brief Количество полученных сообщений с достоверной контрольной суммой,
+     * которые не были отправлены (искажение, не обнаруженное CRC16).
+     */
+    size_t uFalseFramesNumb;
+
+    /**
+     * @brief Количество байт потока, записанных в кольцевой буфер.
+     */
+    size_t uStreamBytesNumb;
+
+    /**
+     * @brief Процессорное время, затраченное обработчиком сообщений (Put() и
+     * ProcessingBatch()), без учета времени генерации потока.
+     */
+    uint64_t uCpuNs;
+} rmp_channel_sim_result_t;
+
+extern void
+RMP_ChannelSimStructInit(rmp_channel_sim_init_t *pxInit);
+
+extern bool
+RMP_ChannelSimInit(
+    rmp_channel_sim_t            *pxSim,
+    const rmp_channel_sim_init_t *pxInit);
+
+extern size_t
+RMP_ChannelSimGenerate(rmp_channel_sim_t *pxSim, void *pDst, size_t uLen);
+
+extern size_t
+RMP_ChannelSimNextChunkSize(rmp_channel_sim_t *pxSim);
+
+extern bool
+RMP_ChannelSimRun(
+    rmp_channel_sim_t        *pxSim,
+    rmp_api_handle_t          hAPI,
+    size_t                    uFramesNumb,
+    rmp_channel_sim_result_t *pxResult);
+
+#endif /* RMP_CHANNEL_SIM_H */
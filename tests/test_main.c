@@ -7,6 +7,12 @@
 #include <windows.h>
 
 #include "radio_message_parser.h"
+#include "radio_message_parser_ring.h"
+#include "rmp_channel_sim.h"
+
+#if (rmpNOTIFY_ENABLE == 1)
+    #include <poll.h>
+#endif
 
 static void
 prvSetup(void);
@@ -17,6 +23,16 @@ prvTeardown(void);
 static rmp_api_handle_t  hAPI;
 static rmp_data_handle_t hData;
 
+/**
+ * @brief Размер кольцевых буферов в тестах сравнения двух экземпляров
+ * (<rmpRING_BACKEND_POW2> требует размер 2^n).
+ */
+#if (rmpRING_BACKEND == rmpRING_BACKEND_POW2)
+    #define testPAIR_RING_SIZE (128u)
+#else
+    #define testPAIR_RING_SIZE (100u)
+#endif
+
 START_TEST(ExampleForMAN)
 {
     // Объявление дескриптора API. Валидный адрес буфер записан при вызове
@@ -177,7 +193,7 @@ START_TEST(CtorIfValid)
     /* Проверка наличия адреса у функций-обработчиков состояний */
     rmp_data_handle_t hData = (rmp_data_handle_t) hAPI;
     for (size_t i = 0u; i < rmpSTATE_MAX_NUMB; ++i) {
-        ck_assert_ptr_nonnull(hData->xStateAPI.aFn[i]);
+        ck_assert_ptr_nonnull(hData->pxStateAPI->aFn[i]);
     }
 
     ck_assert_uint_eq(true, RMP_Dtor(hAPI));
@@ -225,6 +241,105 @@ START_TEST(CheckCrcValidation)
     ck_assert_uint_eq(true, RMP_IsCrcValid((void *) uaPackDef));
 }
 
+START_TEST(CrcEngineMatchBitwise)
+{
+    uint8_t uaSrcMem[256];
+    for (size_t i = 0u; i < sizeof(uaSrcMem); ++i) {
+        uaSrcMem[i] = (uint8_t) (i * 37u + 11u);
+    }
+
+    /* Результат выбранного при сборке алгоритма должен совпадать с побитовым
+     * расчетом при любой длине и любом выравнивании данных */
+    for (size_t uOffset = 0u; uOffset < 8u; ++uOffset) {
+        for (size_t uLen = 0u; uLen <= sizeof(uaSrcMem) - uOffset; ++uLen) {
+            ck_assert_uint_eq(
+                CORE_UpdateCrc16_CCITT_Poly0x1021_Bitwise(
+                    0xFFFF,
+                    &uaSrcMem[uOffset],
+                    uLen),
+                CORE_GetCrc16_CCITT_Poly0x1021(&uaSrcMem[uOffset], uLen));
+        }
+    }
+}
+
+#if (rmpCRC_CLMUL_ENABLE == 1)
+START_TEST(CrcClmulMatchBitwise)
+{
+    if (__builtin_cpu_supports("pclmul") == 0) {
+        return;
+    }
+
+    uint8_t uaSrcMem[512];
+    srand(2024);
+    for (size_t i = 0u; i < sizeof(uaSrcMem); ++i) {
+        uaSrcMem[i] = (uint8_t) rand();
+    }
+
+    /* Ядро PCLMULQDQ должно давать результат, побитно совпадающий с
+     * переносимой реализацией, при любом начальном значении CRC */
+    const uint16_t uaCrcInit[] = {0xFFFF, 0x0000, 0x1D0F, 0xB8A1};
+    for (size_t k = 0u; k < sizeof(uaCrcInit) / sizeof(uaCrcInit[0]); ++k) {
+        for (size_t uLen = 16u; uLen <= sizeof(uaSrcMem) - 3u; ++uLen) {
+            ck_assert_uint_eq(
+                CORE_UpdateCrc16_CCITT_Poly0x1021_Bitwise(
+                    uaCrcInit[k],
+                    &uaSrcMem[3],
+                    uLen),
+                CORE_UpdateCrc16_CCITT_Poly0x1021_Clmul(
+                    uaCrcInit[k],
+                    &uaSrcMem[3],
+                    uLen));
+        }
+    }
+
+    /* Групповой расчет сворачивает по четыре сообщения одновременно,
+     * проверяются длины, не кратные 16-ти, и неполные группы */
+    uint16_t uaCrc[7];
+    for (size_t uLen = 16u; uLen <= 70u; ++uLen) {
+        CORE_GetCrc16_CCITT_Poly0x1021_Multi(uaSrcMem, 71u, uLen, 7u, uaCrc);
+        for (size_t i = 0u; i < 7u; ++i) {
+            ck_assert_uint_eq(
+                CORE_UpdateCrc16_CCITT_Poly0x1021_Bitwise(
+                    0xFFFF,
+                    &uaSrcMem[i * 71u],
+                    uLen),
+                uaCrc[i]);
+        }
+    }
+}
+#endif
+
+START_TEST(CrcValidationMulti)
+{
+    rmp_package_generic_t xaPack[37];
+    bool                  baIsCrcValid[37];
+
+    srand(26);
+    for (size_t i = 0u; i < sizeof(xaPack) / sizeof(xaPack[0]); ++i) {
+        uint8_t *pMem = (uint8_t *) &xaPack[i];
+        for (size_t j = 0u; j < sizeof(xaPack[i]); ++j) {
+            pMem[j] = (uint8_t) rand();
+        }
+
+        RPM_WriteCrcInMessageTail((void *) &xaPack[i]);
+
+        /* Каждое третье сообщение повреждено */
+        if ((i % 3u) == 0u) {
+            xaPack[i].xPLoad.uDummy[i % 16u] ^= 0x10;
+        }
+    }
+
+    size_t uValidNumb = RMP_IsCrcValidMulti(
+        (void *) xaPack,
+        sizeof(xaPack) / sizeof(xaPack[0]),
+        baIsCrcValid);
+
+    ck_assert_uint_eq(24u, uValidNumb);
+    for (size_t i = 0u; i < sizeof(xaPack) / sizeof(xaPack[0]); ++i) {
+        ck_assert_uint_eq(RMP_IsCrcValid((void *) &xaPack[i]), baIsCrcValid[i]);
+    }
+}
+
 START_TEST(APIPutThenRead)
 {
     uint8_t *pSrc    = "Hello World!";
@@ -295,8 +410,12 @@ START_TEST(StateFindStartFrame)
 
         hAPI->Put(hAPI, (void *) ucMessage, sizeof(ucMessage));
 
+        /* Пара байт начала сообщения обнаруживается целиком */
         ck_assert_uint_eq(rmpIN_PROGRESS, RMP_FindFirstByte(hAPI, NULL, 0));
-        ck_assert_uint_eq(rmpIN_PROGRESS, RMP_FindSecondByte(hAPI, NULL, 0));
+        ck_assert_uint_eq(rmpSTATE_WAIT_AND_COPY_MESSAGE, RMP_GetState(hAPI));
+        ck_assert_uint_eq(
+            sizeof(ucMessage) - uSecondByteIdx - 1u,
+            RMP_RingGetFull(&hData->xRing));
     } while (0);
     /*------------------------------------------------------------------------*/
 
@@ -317,12 +436,77 @@ START_TEST(StateFindStartFrame)
 
         hAPI->Put(hAPI, (void *) ucMessage, sizeof(ucMessage));
 
+        ck_assert_uint_eq(rmpBREAK, RMP_FindFirstByte(hAPI, NULL, 0));
+        ck_assert_uint_eq(rmpSTATE_FIND_FIRST_BYTE, RMP_GetState(hAPI));
+        ck_assert_uint_eq(0u, RMP_RingGetFull(&hData->xRing));
+    } while (0);
+    /*------------------------------------------------------------------------*/
+
+    /* Первый байт начала сообщения записан последним, второй еще не получен */
+    do {
+        hAPI->Reset(hAPI);
+
+        uint8_t ucMessage[rmpONE_MESSAGE_SIZE_IN_BYTES] = {0};
+        ucMessage[sizeof(ucMessage) - 1u] = rmpSTART_FRAME_FIRST_BYTE;
+
+        hAPI->Put(hAPI, (void *) ucMessage, sizeof(ucMessage));
+
         ck_assert_uint_eq(rmpIN_PROGRESS, RMP_FindFirstByte(hAPI, NULL, 0));
+        ck_assert_uint_eq(rmpSTATE_FIND_SECOND_BYTE, RMP_GetState(hAPI));
+        ck_assert_uint_eq(rmpBREAK, RMP_FindSecondByte(hAPI, NULL, 0));
+
+        /* Повтор первого байта не сбрасывает поиск 2-го байта */
+        hAPI->Put(hAPI, (void *) &ucMessage[sizeof(ucMessage) - 1u], 1u);
         ck_assert_uint_eq(rmpIN_PROGRESS, RMP_FindSecondByte(hAPI, NULL, 0));
+        ck_assert_uint_eq(rmpSTATE_FIND_SECOND_BYTE, RMP_GetState(hAPI));
+
+        uint8_t uSecondByte = rmpSTART_FRAME_SECOND_BYTE;
+        hAPI->Put(hAPI, (void *) &uSecondByte, 1u);
+        ck_assert_uint_eq(rmpIN_PROGRESS, RMP_FindSecondByte(hAPI, NULL, 0));
+        ck_assert_uint_eq(rmpSTATE_WAIT_AND_COPY_MESSAGE, RMP_GetState(hAPI));
     } while (0);
     /*------------------------------------------------------------------------*/
 }
 
+START_TEST(FindSyncWordMatchNaive)
+{
+    uint8_t uaSrcMem[300];
+
+    srand(4);
+    for (size_t uIter = 0u; uIter < 200u; ++uIter) {
+        /* Чередование случайных данных и данных с высокой плотностью первого
+         * байта пары */
+        for (size_t i = 0u; i < sizeof(uaSrcMem); ++i) {
+            uaSrcMem[i] = (uIter & 1u) ? (uint8_t) rand()
+                                       : ((rand() % 4) ? 0xAA : 0x00);
+        }
+
+        size_t uPos = (size_t) rand() % sizeof(uaSrcMem);
+        if ((uIter % 3u) == 0u) {
+            uaSrcMem[uPos] = rmpSTART_FRAME_SECOND_BYTE;
+        }
+
+        for (size_t uLen = 0u; uLen <= sizeof(uaSrcMem); uLen += 7u) {
+            size_t uExpected = uLen;
+            for (size_t i = 0u; (i + 1u) < uLen; ++i) {
+                if ((uaSrcMem[i] == rmpSTART_FRAME_FIRST_BYTE)
+                    && (uaSrcMem[i + 1u] == rmpSTART_FRAME_SECOND_BYTE)) {
+                    uExpected = i;
+                    break;
+                }
+            }
+
+            ck_assert_uint_eq(
+                uExpected,
+                RMP_FindSyncWord(
+                    uaSrcMem,
+                    uLen,
+                    rmpSTART_FRAME_FIRST_BYTE,
+                    rmpSTART_FRAME_SECOND_BYTE));
+        }
+    }
+}
+
 START_TEST(FindStartFrameAndCopyMessage)
 {
     do {
@@ -441,6 +625,50 @@ START_TEST(FindStartFrameAndCopySomeMessages)
     } while (0);
 }
 
+START_TEST(FindStartFrameAcrossBufferWrap)
+{
+    /* Смещение указателей кольцевого буфера так, чтобы следующее сообщение
+     * оказалось разделено границей буфера */
+    for (size_t uShift = 100u; uShift < 128u; ++uShift) {
+        hAPI->Reset(hAPI);
+
+        uint8_t uaNoise[128];
+        memset(uaNoise, 0x5A, sizeof(uaNoise));
+        ck_assert_uint_eq(uShift, hAPI->Put(hAPI, uaNoise, uShift));
+
+        /* Шум отбрасывается за несколько вызовов Processing(), количество
+         * которых определяется ограничением <uReadBytesThreshold> */
+        rmp_package_generic_t xDstMem = {0};
+        do {
+            ck_assert_uint_eq(
+                0u,
+                hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+        } while (RMP_GetStopReason(hAPI) == rmpSTOP_REASON_BYTES_BUDGET);
+
+        ck_assert_uint_eq(rmpSTOP_REASON_NO_DATA, RMP_GetStopReason(hAPI));
+        ck_assert_uint_eq(0u, RMP_RingGetFull(&hData->xRing));
+
+        /* Перед сообщением записаны ложные первые байты пары */
+        uint8_t uaSrcMem[7u + rmpONE_MESSAGE_SIZE_IN_BYTES] = {
+            0x00, rmpSTART_FRAME_FIRST_BYTE, 0x00, 0x00,
+            rmpSTART_FRAME_FIRST_BYTE, 0x01, rmpSTART_FRAME_FIRST_BYTE};
+        uint8_t *pStartMessage = &uaSrcMem[7];
+        pStartMessage[0]       = rmpSTART_FRAME_FIRST_BYTE;
+        pStartMessage[1]       = rmpSTART_FRAME_SECOND_BYTE;
+        pStartMessage[5]       = (uint8_t) uShift;
+        RPM_WriteCrcInMessageTail((void *) pStartMessage);
+
+        ck_assert_uint_eq(
+            sizeof(uaSrcMem),
+            hAPI->Put(hAPI, uaSrcMem, sizeof(uaSrcMem)));
+
+        ck_assert_uint_eq(
+            rmpONE_MESSAGE_SIZE_IN_BYTES,
+            hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+        ck_assert_mem_eq(pStartMessage, (void *) &xDstMem, sizeof(xDstMem));
+    }
+}
+
 START_TEST(FindStartFrameAndCopyMessageInSmallDstBuff)
 {
     /* Сформируем первое сообщение, выполним побайтную запись и чтение */
@@ -474,6 +702,1757 @@ START_TEST(FindStartFrameAndCopyMessageInSmallDstBuff)
     } while (0);
 }
 
+START_TEST(AcquireFrameZeroCopy)
+{
+    const uint8_t *pRbBegin = RMP_RingGetBuff(&hData->xRing);
+    const uint8_t *pRbEnd   = pRbBegin + RMP_RingGetSize(&hData->xRing);
+
+    for (size_t uShift = 0u; uShift < 128u; ++uShift) {
+        hAPI->Reset(hAPI);
+
+        /* Позиция чтения после Reset() зависит от реализации кольцевого
+         * буфера */
+        const size_t uResetOffset =
+            (size_t) (RMP_RingGetReadAddress(&hData->xRing) - pRbBegin);
+
+        /* Смещение указателей кольцевого буфера */
+        uint8_t uaNoise[128] = {0};
+        hAPI->Put(hAPI, uaNoise, uShift);
+        RMP_Get(hAPI, uaNoise, uShift);
+
+        /* Шумовой байт, недостоверное сообщение, отбрасываемое целиком, и
+         * следующее за ним достоверное сообщение */
+        const size_t uFrameIdx = 1u + rmpONE_MESSAGE_SIZE_IN_BYTES;
+        uint8_t uaSrcMem[1u + (2u * rmpONE_MESSAGE_SIZE_IN_BYTES)] = {0};
+        uaSrcMem[1]            = rmpSTART_FRAME_FIRST_BYTE;
+        uaSrcMem[2]            = rmpSTART_FRAME_SECOND_BYTE;
+        uint8_t *pStartMessage = &uaSrcMem[uFrameIdx];
+        pStartMessage[0]       = rmpSTART_FRAME_FIRST_BYTE;
+        pStartMessage[1]       = rmpSTART_FRAME_SECOND_BYTE;
+        pStartMessage[4]       = (uint8_t) uShift;
+        RPM_WriteCrcInMessageTail((void *) pStartMessage);
+
+        /* Сообщение записано не полностью */
+        hAPI->Put(hAPI, uaSrcMem, sizeof(uaSrcMem) - 1u);
+        ck_assert_ptr_null(hAPI->AcquireFrame(hAPI));
+
+        hAPI->Put(hAPI, &uaSrcMem[sizeof(uaSrcMem) - 1u], 1u);
+        const uint8_t *pFrame = hAPI->AcquireFrame(hAPI);
+        ck_assert_ptr_nonnull(pFrame);
+        ck_assert_mem_eq(pStartMessage, pFrame, rmpONE_MESSAGE_SIZE_IN_BYTES);
+
+        /* Копирование выполняется только для сообщения, разделенного точкой
+         * перехода через границу буфера */
+        size_t uRbSize      = RMP_RingGetSize(&hData->xRing);
+        size_t uFrameOffset = (uResetOffset + uShift + uFrameIdx) % uRbSize;
+        bool   bIsSplit =
+            (uFrameOffset + rmpONE_MESSAGE_SIZE_IN_BYTES) > uRbSize;
+        ck_assert_uint_eq(
+            !bIsSplit,
+            (pFrame >= pRbBegin) && (pFrame < pRbEnd));
+
+        /* Повторный вызов возвращает то же сообщение */
+        ck_assert_ptr_eq(pFrame, hAPI->AcquireFrame(hAPI));
+
+        hAPI->ReleaseFrame(hAPI);
+        ck_assert_uint_eq(0u, RMP_RingGetFull(&hData->xRing));
+        ck_assert_ptr_null(hAPI->AcquireFrame(hAPI));
+    }
+}
+
+START_TEST(AcquireFrameAfterProcessing)
+{
+    uint8_t uaSrcMem[rmpONE_MESSAGE_SIZE_IN_BYTES] = {0};
+    uaSrcMem[0]                                    = rmpSTART_FRAME_FIRST_BYTE;
+    uaSrcMem[1]                                    = rmpSTART_FRAME_SECOND_BYTE;
+    uaSrcMem[9]                                    = 99u;
+    RPM_WriteCrcInMessageTail((void *) uaSrcMem);
+
+    /* Байты начала сообщения считаны вызовом Processing() */
+    rmp_package_generic_t xDstMem;
+    hAPI->Put(hAPI, uaSrcMem, 5u);
+    ck_assert_uint_eq(
+        0u,
+        hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert_uint_eq(rmpSTATE_WAIT_AND_COPY_MESSAGE, RMP_GetState(hAPI));
+
+    hAPI->Put(hAPI, &uaSrcMem[5], sizeof(uaSrcMem) - 5u);
+
+    const void *pFrame = hAPI->AcquireFrame(hAPI);
+    ck_assert_ptr_nonnull(pFrame);
+    ck_assert_mem_eq(uaSrcMem, pFrame, sizeof(uaSrcMem));
+
+    hAPI->ReleaseFrame(hAPI);
+    ck_assert_ptr_null(hAPI->AcquireFrame(hAPI));
+}
+
+START_TEST(ProcessingBatch)
+{
+    /* Пять сообщений, одно из которых повреждено, разделенные шумом */
+    uint8_t uaSrcMem[5u * (rmpONE_MESSAGE_SIZE_IN_BYTES + 3u)] = {0};
+    uint8_t *pMessage[5];
+    for (size_t i = 0u; i < 5u; ++i) {
+        pMessage[i] = &uaSrcMem[i * (rmpONE_MESSAGE_SIZE_IN_BYTES + 3u) + 3u];
+        pMessage[i][0] = rmpSTART_FRAME_FIRST_BYTE;
+        pMessage[i][1] = rmpSTART_FRAME_SECOND_BYTE;
+        pMessage[i][2] = (uint8_t) i;
+        RPM_WriteCrcInMessageTail((void *) pMessage[i]);
+    }
+    pMessage[2][5] ^= 0x01;
+
+    ck_assert_uint_eq(
+        sizeof(uaSrcMem),
+        hAPI->Put(hAPI, uaSrcMem, sizeof(uaSrcMem)));
+
+    /* Недостоверное сообщение не прерывает обработку */
+    rmp_package_generic_t xaDstMem[8];
+    size_t                uConsumedBytesNumb = 0u;
+    ck_assert_uint_eq(
+        4u,
+        hAPI->ProcessingBatch(hAPI, xaDstMem, 8u, 0u, &uConsumedBytesNumb));
+    ck_assert_uint_eq(sizeof(uaSrcMem), uConsumedBytesNumb);
+
+    ck_assert_mem_eq(pMessage[0], &xaDstMem[0], sizeof(xaDstMem[0]));
+    ck_assert_mem_eq(pMessage[1], &xaDstMem[1], sizeof(xaDstMem[0]));
+    ck_assert_mem_eq(pMessage[3], &xaDstMem[2], sizeof(xaDstMem[0]));
+    ck_assert_mem_eq(pMessage[4], &xaDstMem[3], sizeof(xaDstMem[0]));
+    /*------------------------------------------------------------------------*/
+
+    /* Ограничение количества сообщений и количества считанных байт */
+    hAPI->Put(hAPI, uaSrcMem, sizeof(uaSrcMem));
+    ck_assert_uint_eq(
+        1u,
+        hAPI->ProcessingBatch(hAPI, xaDstMem, 1u, 0u, &uConsumedBytesNumb));
+    ck_assert_uint_eq(
+        rmpONE_MESSAGE_SIZE_IN_BYTES + 3u,
+        uConsumedBytesNumb);
+
+    size_t uTotalBytesNumb = uConsumedBytesNumb;
+    size_t uFramesNumb     = 1u;
+    while (uTotalBytesNumb < sizeof(uaSrcMem)) {
+        uFramesNumb += hAPI->ProcessingBatch(
+            hAPI,
+            &xaDstMem[uFramesNumb],
+            8u - uFramesNumb,
+            10u,
+            &uConsumedBytesNumb);
+
+        ck_assert_uint_ne(0u, uConsumedBytesNumb);
+        ck_assert_uint_gt(
+            10u + rmpONE_MESSAGE_SIZE_IN_BYTES,
+            uConsumedBytesNumb);
+        uTotalBytesNumb += uConsumedBytesNumb;
+    }
+    ck_assert_uint_eq(sizeof(uaSrcMem), uTotalBytesNumb);
+    ck_assert_uint_eq(4u, uFramesNumb);
+    ck_assert_mem_eq(pMessage[4], &xaDstMem[3], sizeof(xaDstMem[0]));
+}
+
+START_TEST(ResyncOnCrcError)
+{
+    /* Ложное начало сообщения, за которым через 3 байта следует достоверное
+     * сообщение */
+    uint8_t uaSrcMem[5u + rmpONE_MESSAGE_SIZE_IN_BYTES] = {
+        rmpSTART_FRAME_FIRST_BYTE,
+        rmpSTART_FRAME_SECOND_BYTE};
+    uint8_t *pStartMessage = &uaSrcMem[5];
+    pStartMessage[0]       = rmpSTART_FRAME_FIRST_BYTE;
+    pStartMessage[1]       = rmpSTART_FRAME_SECOND_BYTE;
+    pStartMessage[2]       = 0x42;
+    RPM_WriteCrcInMessageTail((void *) pStartMessage);
+
+    /* Без восстановления синхронизации достоверное сообщение отбрасывается
+     * вместе с ложным */
+    rmp_package_generic_t xDstMem;
+    hAPI->Put(hAPI, uaSrcMem, sizeof(uaSrcMem));
+    while (RMP_RingGetFull(&hData->xRing) != 0u) {
+        ck_assert_uint_eq(
+            0u,
+            hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    }
+
+    /* AcquireFrame() при недостоверной контрольной сумме отбрасывает байты
+     * так же, как Processing() */
+    hAPI->Put(hAPI, uaSrcMem, sizeof(uaSrcMem));
+    while (RMP_RingGetFull(&hData->xRing) != 0u) {
+        ck_assert_ptr_null(hAPI->AcquireFrame(hAPI));
+    }
+    /*------------------------------------------------------------------------*/
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+
+    uint8_t ucRbMemAlloc[64];
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.bIsResyncOnCrcError  = true;
+
+    rmp_obj_t xDataMemAlloc;
+    xInit.hData                 = &xDataMemAlloc;
+
+    rmp_api_handle_t hResyncAPI = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hResyncAPI);
+
+    hResyncAPI->Put(hResyncAPI, uaSrcMem, sizeof(uaSrcMem));
+    ck_assert_uint_eq(
+        0u,
+        hResyncAPI->Processing(hResyncAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert_uint_eq(
+        rmpONE_MESSAGE_SIZE_IN_BYTES,
+        hResyncAPI->Processing(hResyncAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert_mem_eq(pStartMessage, &xDstMem, sizeof(xDstMem));
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+    hResyncAPI->Put(hResyncAPI, uaSrcMem, sizeof(uaSrcMem));
+    const void *pFrame = hResyncAPI->AcquireFrame(hResyncAPI);
+    ck_assert_ptr_nonnull(pFrame);
+    ck_assert_mem_eq(pStartMessage, pFrame, rmpONE_MESSAGE_SIZE_IN_BYTES);
+    hResyncAPI->ReleaseFrame(hResyncAPI);
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+    ck_assert_uint_eq(true, RMP_Dtor(hResyncAPI));
+}
+
+START_TEST(ProcessingBudget)
+{
+    const size_t uThreshold = hData->uReadBytesThreshold;
+    ck_assert_uint_ne(0u, uThreshold);
+
+    uint8_t uaNoise[100];
+    memset(uaNoise, 0x5A, sizeof(uaNoise));
+    hAPI->Put(hAPI, uaNoise, sizeof(uaNoise));
+
+    /* Каждый вызов считывает не более <uReadBytesThreshold> байт */
+    rmp_package_generic_t xDstMem = {0};
+    size_t                uLeft   = sizeof(uaNoise);
+    while (uLeft > uThreshold) {
+        ck_assert_uint_eq(
+            0u,
+            hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+        ck_assert_uint_eq(
+            rmpSTOP_REASON_BYTES_BUDGET,
+            RMP_GetStopReason(hAPI));
+
+        uLeft -= uThreshold;
+        ck_assert_uint_eq(uLeft, RMP_RingGetFull(&hData->xRing));
+    }
+
+    ck_assert_uint_eq(
+        0u,
+        hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert_uint_eq(rmpSTOP_REASON_NO_DATA, RMP_GetStopReason(hAPI));
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&hData->xRing));
+
+    /* Вызов, извлекший сообщение, завершается по ограничению количества
+     * сообщений */
+    rmp_package_generic_t xaSrcMem[2] = {0};
+    for (size_t i = 0u; i < 2u; ++i) {
+        xaSrcMem[i].xHead.uFirstByte  = rmpSTART_FRAME_FIRST_BYTE;
+        xaSrcMem[i].xHead.uSecondByte = rmpSTART_FRAME_SECOND_BYTE;
+        xaSrcMem[i].xPLoad.uDummy[0]  = (uint8_t) i;
+        RPM_WriteCrcInMessageTail((void *) &xaSrcMem[i]);
+    }
+    hAPI->Put(hAPI, xaSrcMem, sizeof(xaSrcMem));
+
+    ck_assert_uint_eq(
+        rmpONE_MESSAGE_SIZE_IN_BYTES,
+        hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert_uint_eq(rmpSTOP_REASON_FRAMES_BUDGET, RMP_GetStopReason(hAPI));
+
+    ck_assert_uint_eq(
+        1u,
+        hAPI->ProcessingBatch(hAPI, &xDstMem, 1u, 0u, NULL));
+    ck_assert_uint_eq(rmpSTOP_REASON_FRAMES_BUDGET, RMP_GetStopReason(hAPI));
+    ck_assert_mem_eq(&xaSrcMem[1], &xDstMem, sizeof(xDstMem));
+
+    ck_assert_uint_eq(
+        0u,
+        hAPI->ProcessingBatch(hAPI, &xDstMem, 1u, 0u, NULL));
+    ck_assert_uint_eq(rmpSTOP_REASON_NO_DATA, RMP_GetStopReason(hAPI));
+}
+
+START_TEST(WriteSpanSimulatedDMA)
+{
+    const uint8_t *pRbMem  = RMP_RingGetBuff(&hData->xRing);
+    const size_t   uRbSize = RMP_RingGetSize(&hData->xRing);
+
+    /* Сообщения разделены шумом, поток записывается порциями разного размера,
+     * поэтому блоки и сообщения пересекают границу буфера */
+    uint8_t               uaStream[10u * (3u + rmpONE_MESSAGE_SIZE_IN_BYTES)];
+    rmp_package_generic_t xaSrcMem[10];
+    size_t                uStreamLen = 0u;
+
+    for (size_t i = 0u; i < 10u; ++i) {
+        uaStream[uStreamLen++] = 0x00;
+        uaStream[uStreamLen++] = 0x11;
+        uaStream[uStreamLen++] = 0x22;
+
+        memset((void *) &xaSrcMem[i], 0, sizeof(xaSrcMem[i]));
+        xaSrcMem[i].xHead.uFirstByte  = rmpSTART_FRAME_FIRST_BYTE;
+        xaSrcMem[i].xHead.uSecondByte = rmpSTART_FRAME_SECOND_BYTE;
+        xaSrcMem[i].xPLoad.uDummy[0]  = (uint8_t) i;
+        RPM_WriteCrcInMessageTail((void *) &xaSrcMem[i]);
+
+        memcpy(&uaStream[uStreamLen], &xaSrcMem[i], sizeof(xaSrcMem[i]));
+        uStreamLen += sizeof(xaSrcMem[i]);
+    }
+
+    const size_t          uaChunkLen[] = {7u, 13u, 29u};
+    rmp_package_generic_t xaDstMem[10];
+    size_t                uFramesNumb = 0u;
+
+    for (size_t uPos = 0u, uIter = 0u; uPos < uStreamLen; ++uIter) {
+        size_t   uSpanLen = 0u;
+        uint8_t *pSpan    = (uint8_t *) hAPI->GetWriteSpan(hAPI, &uSpanLen);
+
+        /* Блок расположен в памяти кольцевого буфера */
+        ck_assert_ptr_nonnull(pSpan);
+        ck_assert(pSpan >= pRbMem);
+        ck_assert(pSpan + uSpanLen <= pRbMem + uRbSize);
+
+        size_t uLen = uaChunkLen[uIter % 3u];
+        if (uLen > uSpanLen) {
+            uLen = uSpanLen;
+        }
+        if (uLen > (uStreamLen - uPos)) {
+            uLen = uStreamLen - uPos;
+        }
+
+        /* Запись DMA напрямую в кольцевой буфер */
+        memcpy(pSpan, &uaStream[uPos], uLen);
+        ck_assert_uint_eq(uLen, hAPI->CommitWrite(hAPI, uLen));
+        uPos += uLen;
+
+        uFramesNumb += hAPI->ProcessingBatch(
+            hAPI,
+            &xaDstMem[uFramesNumb],
+            10u - uFramesNumb,
+            0u,
+            NULL);
+    }
+
+    ck_assert_uint_eq(10u, uFramesNumb);
+    ck_assert_mem_eq(xaSrcMem, xaDstMem, sizeof(xaSrcMem));
+
+    /* Заполнение всего свободного места буфера */
+    size_t uFilledLen = 0u;
+    size_t uSpanLen   = 0u;
+    while (hAPI->GetWriteSpan(hAPI, &uSpanLen) != NULL) {
+        uFilledLen += hAPI->CommitWrite(hAPI, uSpanLen);
+    }
+    ck_assert_uint_eq(0u, uSpanLen);
+    ck_assert_uint_eq(uRbSize - 1u, uFilledLen);
+
+    /* В заполненный буфер байты не фиксируются */
+    ck_assert_uint_eq(0u, hAPI->CommitWrite(hAPI, 1u));
+}
+
+START_TEST(MirroredMemFrameAcrossSeam)
+{
+#if (rmpMIRROR_MEM_ENABLE == 1)
+    size_t   uSize = 0u;
+    uint8_t *pMem  = (uint8_t *) RMP_MirrorMemAlloc(100u, &uSize);
+    ck_assert_ptr_nonnull(pMem);
+    ck_assert_uint_ge(uSize, 100u);
+
+    /* Вторая половина области памяти отображает первую */
+    pMem[3] = 0x5A;
+    ck_assert_uint_eq(0x5A, pMem[uSize + 3u]);
+
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc             = (void *) pMem;
+    xInit.uMemAllocSizeInBytes  = uSize;
+    xInit.hData                 = &xDataMemAlloc;
+    xInit.bIsMirroredMem        = true;
+    xInit.uReadBytesThreshold   = 0u;
+
+    rmp_api_handle_t hMirrorAPI = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hMirrorAPI);
+
+    rmp_package_generic_t xSrcMem = {0};
+    xSrcMem.xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+    xSrcMem.xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+    for (size_t i = 0u; i < sizeof(xSrcMem.xPLoad.uDummy); ++i) {
+        xSrcMem.xPLoad.uDummy[i] = (uint8_t) i;
+    }
+    RPM_WriteCrcInMessageTail((void *) &xSrcMem);
+
+    /* Сообщение разделяется границей буфера при каждом смещении */
+    for (size_t uShift = 1u; uShift < sizeof(xSrcMem); ++uShift) {
+        hMirrorAPI->Reset(hMirrorAPI);
+
+        /* Смещение указателей кольцевого буфера */
+        size_t uNoiseLen = uSize - uShift;
+        while (uNoiseLen != 0u) {
+            size_t uSpanLen = 0u;
+            void  *pSpan = hMirrorAPI->GetWriteSpan(hMirrorAPI, &uSpanLen);
+            size_t uLen  = (uNoiseLen < uSpanLen) ? uNoiseLen : uSpanLen;
+
+            memset(pSpan, 0x00, uLen);
+            uNoiseLen -= hMirrorAPI->CommitWrite(hMirrorAPI, uLen);
+            RMP_Skip(hMirrorAPI, uLen);
+        }
+
+        /* Свободное место, как и данные, расположено непрерывно */
+        size_t uSpanLen = 0u;
+        ck_assert_ptr_nonnull(hMirrorAPI->GetWriteSpan(hMirrorAPI, &uSpanLen));
+#if (rmpRING_BACKEND == rmpRING_BACKEND_SPSC)
+        /* Размер блока определяется по копии позиции чтения */
+        ck_assert_uint_ge(uSpanLen, sizeof(xSrcMem));
+        ck_assert_uint_eq(uSize - 1u, RMP_RingGetFree(&xDataMemAlloc.xRing));
+#else
+        ck_assert_uint_eq(uSize - 1u, uSpanLen);
+#endif
+
+        hMirrorAPI->Put(hMirrorAPI, &xSrcMem, sizeof(xSrcMem));
+
+        /* Сообщение возвращается без копирования во внутренний буфер */
+        const void *pFrame = hMirrorAPI->AcquireFrame(hMirrorAPI);
+        ck_assert_ptr_nonnull(pFrame);
+        ck_assert(pFrame != (const void *) xDataMemAlloc.uaStaging);
+        ck_assert((const uint8_t *) pFrame < pMem + uSize);
+        ck_assert_mem_eq(&xSrcMem, pFrame, sizeof(xSrcMem));
+        hMirrorAPI->ReleaseFrame(hMirrorAPI);
+
+        hMirrorAPI->Put(hMirrorAPI, &xSrcMem, sizeof(xSrcMem));
+
+        rmp_package_generic_t xDstMem = {0};
+        ck_assert_uint_eq(
+            rmpONE_MESSAGE_SIZE_IN_BYTES,
+            hMirrorAPI->Processing(
+                hMirrorAPI,
+                (void *) &xDstMem,
+                sizeof(xDstMem)));
+        ck_assert_mem_eq(&xSrcMem, &xDstMem, sizeof(xDstMem));
+    }
+
+    ck_assert_uint_eq(true, RMP_Dtor(hMirrorAPI));
+    ck_assert(RMP_MirrorMemFree(pMem, uSize));
+#endif
+}
+
+START_TEST(CustomFrameDesc)
+{
+    /* Формат: 2 байта начала сообщения, контрольная сумма, 8 байт полезной
+     * нагрузки, по которой рассчитывается контрольная сумма */
+    const rmp_frame_desc_t xDesc = {
+        .uSyncFirstByte          = 0x7E,
+        .uSyncSecondByte         = 0x81,
+        .uFrameSizeInBytes       = 12u,
+        .uCrcOffset              = 2u,
+        .uCrcCoverageOffset      = 4u,
+        .uCrcCoverageSizeInBytes = 8u,
+    };
+
+    static uint8_t   ucRbMemAlloc[64];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+
+    /* Формат по умолчанию обрабатывается специализированным вариантом */
+    rmp_api_handle_t hDescAPI  = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hDescAPI);
+    ck_assert_ptr_eq(
+        RMP_WaitAndCopyMessage,
+        xDataMemAlloc.pxStateAPI->aFn[rmpSTATE_WAIT_AND_COPY_MESSAGE]);
+
+    /* Таблица функций состояний общая для экземпляров одного формата */
+    ck_assert_ptr_eq(hData->pxStateAPI, xDataMemAlloc.pxStateAPI);
+    ck_assert_uint_eq(true, RMP_Dtor(hDescAPI));
+
+    /* Недопустимые форматы */
+    xInit.xFrameDesc                   = xDesc;
+    xInit.xFrameDesc.uFrameSizeInBytes = rmpFRAME_MAX_SIZE_IN_BYTES + 1u;
+    ck_assert_ptr_null(RMP_Ctor(&xInit));
+
+    xInit.xFrameDesc            = xDesc;
+    xInit.xFrameDesc.uCrcOffset = 11u;
+    ck_assert_ptr_null(RMP_Ctor(&xInit));
+
+    xInit.xFrameDesc                         = xDesc;
+    xInit.xFrameDesc.uCrcCoverageSizeInBytes = 9u;
+    ck_assert_ptr_null(RMP_Ctor(&xInit));
+
+    xInit.xFrameDesc = xDesc;
+    hDescAPI         = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hDescAPI);
+    ck_assert_ptr_eq(
+        RMP_WaitAndCopyFrame,
+        xDataMemAlloc.pxStateAPI->aFn[rmpSTATE_WAIT_AND_COPY_MESSAGE]);
+
+    uint8_t uaFrame[12] = {0x7E, 0x81, 0u, 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u};
+    RMP_WriteFrameCrc(&xDesc, uaFrame);
+    ck_assert(RMP_IsFrameCrcValid(&xDesc, uaFrame));
+
+    /* Сообщения формата по умолчанию не распознаются */
+    rmp_package_generic_t xGenericMem = {0};
+    xGenericMem.xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+    xGenericMem.xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+    RPM_WriteCrcInMessageTail((void *) &xGenericMem);
+
+    uint8_t uaDstMem[3u * sizeof(uaFrame)] = {0};
+
+    /* Сообщения пересекают границу буфера при разных смещениях */
+    for (size_t uShift = 0u; uShift < sizeof(ucRbMemAlloc); uShift += 5u) {
+        hDescAPI->Reset(hDescAPI);
+
+        uint8_t uaNoise[64] = {0};
+        hDescAPI->Put(hDescAPI, uaNoise, uShift);
+        RMP_Skip(hDescAPI, uShift);
+
+        hDescAPI->Put(hDescAPI, &xGenericMem, sizeof(xGenericMem));
+        hDescAPI->Put(hDescAPI, uaFrame, sizeof(uaFrame));
+        ck_assert_uint_eq(
+            sizeof(uaFrame),
+            hDescAPI->Processing(hDescAPI, uaDstMem, sizeof(uaDstMem)));
+        ck_assert_mem_eq(uaFrame, uaDstMem, sizeof(uaFrame));
+
+        /* Сообщения записываются в массив с шагом, равным их размеру */
+        hDescAPI->Put(hDescAPI, uaFrame, sizeof(uaFrame));
+        hDescAPI->Put(hDescAPI, uaFrame, sizeof(uaFrame));
+        memset(uaDstMem, 0, sizeof(uaDstMem));
+        ck_assert_uint_eq(
+            2u,
+            hDescAPI->ProcessingBatch(hDescAPI, uaDstMem, 3u, 0u, NULL));
+        ck_assert_mem_eq(uaFrame, &uaDstMem[0], sizeof(uaFrame));
+        ck_assert_mem_eq(uaFrame, &uaDstMem[sizeof(uaFrame)], sizeof(uaFrame));
+
+        hDescAPI->Put(hDescAPI, uaFrame, sizeof(uaFrame));
+        const void *pFrame = hDescAPI->AcquireFrame(hDescAPI);
+        ck_assert_ptr_nonnull(pFrame);
+        ck_assert_mem_eq(uaFrame, pFrame, sizeof(uaFrame));
+        hDescAPI->ReleaseFrame(hDescAPI);
+        ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+    }
+
+    ck_assert_uint_eq(true, RMP_Dtor(hDescAPI));
+}
+
+START_TEST(LengthPrefixedFrame)
+{
+    /* Контрольная сумма рассчитывается по байту длины и полезной нагрузке */
+    const rmp_frame_desc_t xDesc = {
+        .uSyncFirstByte         = rmpSTART_FRAME_FIRST_BYTE,
+        .uSyncSecondByte        = rmpSTART_FRAME_SECOND_BYTE,
+        .uFrameSizeInBytes      = 5u + 32u,
+        .uCrcCoverageOffset     = 2u,
+        .bIsLengthPrefixed      = true,
+        .uMinPayloadSizeInBytes = 1u,
+    };
+
+    static uint8_t   ucRbMemAlloc[128];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+    xInit.xFrameDesc           = xDesc;
+
+    rmp_api_handle_t hVarAPI   = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hVarAPI);
+
+    /* Сообщения разной длины, между которыми записаны заголовки с
+     * недопустимой длиной */
+    const size_t auPayloadSize[] = {7u, 1u, 32u};
+    uint8_t      uaFrame[3][5u + 32u];
+    uint8_t      uaStream[256];
+    size_t       uStreamLen = 0u;
+
+    for (size_t i = 0u; i < 3u; ++i) {
+        rmp_frame_desc_t xFrameDesc;
+        ck_assert(RMP_GetLengthPrefixedFrameDesc(
+            &xDesc,
+            auPayloadSize[i],
+            &xFrameDesc));
+
+        uaFrame[i][0] = rmpSTART_FRAME_FIRST_BYTE;
+        uaFrame[i][1] = rmpSTART_FRAME_SECOND_BYTE;
+        uaFrame[i][2] = (uint8_t) auPayloadSize[i];
+        for (size_t j = 0u; j < auPayloadSize[i]; ++j) {
+            uaFrame[i][3u + j] = (uint8_t) (i * 16u + j);
+        }
+        RMP_WriteFrameCrc(&xFrameDesc, uaFrame[i]);
+
+        const uint8_t uaInvalidHead[] = {
+            0x00,
+            rmpSTART_FRAME_FIRST_BYTE,
+            rmpSTART_FRAME_SECOND_BYTE,
+            (i == 0u) ? 200u : 0u};
+        memcpy(&uaStream[uStreamLen], uaInvalidHead, sizeof(uaInvalidHead));
+        uStreamLen += sizeof(uaInvalidHead);
+
+        memcpy(&uaStream[uStreamLen], uaFrame[i], xFrameDesc.uFrameSizeInBytes);
+        uStreamLen += xFrameDesc.uFrameSizeInBytes;
+    }
+
+    rmp_frame_desc_t xInvalidDesc;
+    ck_assert(!RMP_GetLengthPrefixedFrameDesc(&xDesc, 0u, &xInvalidDesc));
+    ck_assert(!RMP_GetLengthPrefixedFrameDesc(&xDesc, 33u, &xInvalidDesc));
+
+    /* Побайтная запись, Processing() возвращает размер каждого сообщения */
+    uint8_t uaDstMem[3u * (5u + 32u)] = {0};
+    size_t  uFramesNumb               = 0u;
+    for (size_t i = 0u; i < uStreamLen; ++i) {
+        hVarAPI->Put(hVarAPI, &uaStream[i], 1u);
+
+        size_t uSize =
+            hVarAPI->Processing(hVarAPI, uaDstMem, sizeof(uaDstMem));
+        if (uSize != 0u) {
+            ck_assert_uint_lt(uFramesNumb, 3u);
+            ck_assert_uint_eq(5u + auPayloadSize[uFramesNumb], uSize);
+            ck_assert_mem_eq(uaFrame[uFramesNumb], uaDstMem, uSize);
+            uFramesNumb++;
+        }
+    }
+    ck_assert_uint_eq(3u, uFramesNumb);
+
+    /* Сообщения записываются в массив с шагом, равным максимальному размеру
+     * сообщения */
+    hVarAPI->Put(hVarAPI, uaStream, uStreamLen / 2u);
+    uFramesNumb = hVarAPI->ProcessingBatch(hVarAPI, uaDstMem, 3u, 0u, NULL);
+    hVarAPI->Put(
+        hVarAPI,
+        &uaStream[uStreamLen / 2u],
+        uStreamLen - uStreamLen / 2u);
+    uFramesNumb += hVarAPI->ProcessingBatch(
+        hVarAPI,
+        &uaDstMem[uFramesNumb * xDesc.uFrameSizeInBytes],
+        3u - uFramesNumb,
+        0u,
+        NULL);
+    ck_assert_uint_eq(3u, uFramesNumb);
+    for (size_t i = 0u; i < 3u; ++i) {
+        ck_assert_mem_eq(
+            uaFrame[i],
+            &uaDstMem[i * xDesc.uFrameSizeInBytes],
+            5u + auPayloadSize[i]);
+    }
+
+    /* Сообщения без копирования */
+    hVarAPI->Put(hVarAPI, uaStream, uStreamLen / 2u);
+    uFramesNumb = 0u;
+    for (size_t uPart = 0u; uPart < 2u; ++uPart) {
+        const uint8_t *pFrame;
+        while ((pFrame = hVarAPI->AcquireFrame(hVarAPI)) != NULL) {
+            ck_assert_uint_eq(auPayloadSize[uFramesNumb], pFrame[2]);
+            ck_assert_mem_eq(
+                uaFrame[uFramesNumb],
+                pFrame,
+                5u + auPayloadSize[uFramesNumb]);
+            hVarAPI->ReleaseFrame(hVarAPI);
+            uFramesNumb++;
+        }
+
+        if (uPart == 0u) {
+            hVarAPI->Put(
+                hVarAPI,
+                &uaStream[uStreamLen / 2u],
+                uStreamLen - uStreamLen / 2u);
+        }
+    }
+    ck_assert_uint_eq(3u, uFramesNumb);
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+    ck_assert_uint_eq(true, RMP_Dtor(hVarAPI));
+}
+
+START_TEST(OverflowPolicy)
+{
+    static uint8_t   ucRbMemAlloc[64];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+    xInit.uReadBytesThreshold  = 0u;
+
+    rmp_package_generic_t xaPack[8];
+    for (size_t i = 0u; i < 8u; ++i) {
+        memset(&xaPack[i], 0, sizeof(xaPack[i]));
+        xaPack[i].xHead.uFirstByte  = rmpSTART_FRAME_FIRST_BYTE;
+        xaPack[i].xHead.uSecondByte = rmpSTART_FRAME_SECOND_BYTE;
+        xaPack[i].xPLoad.uDummy[0]  = (uint8_t) i;
+        RPM_WriteCrcInMessageTail((void *) &xaPack[i]);
+    }
+
+    rmp_package_generic_t xDstMem;
+    rmp_stats_t           xStats;
+
+    xInit.eOverflowPolicy = rmpOVERFLOW_POLICY_MAX_NUMB;
+    ck_assert_ptr_null(RMP_Ctor(&xInit));
+
+    /* Самые новые байты отбрасываются */
+    xInit.eOverflowPolicy    = rmpOVERFLOW_POLICY_REJECT_NEWEST;
+    rmp_api_handle_t hOvfAPI = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hOvfAPI);
+    ck_assert_uint_eq(60u, hOvfAPI->Put(hOvfAPI, xaPack, 3u * 20u));
+    ck_assert_uint_eq(3u, hOvfAPI->Put(hOvfAPI, &xaPack[3], 20u));
+    ck_assert_uint_eq(true, RMP_Dtor(hOvfAPI));
+
+#if (rmpRING_BACKEND != rmpRING_BACKEND_LWRB)
+    /* Политики, удаляющие байты в Put(), изменяют позицию чтения, которая
+     * принадлежит потоку обработки */
+    xInit.eOverflowPolicy = rmpOVERFLOW_POLICY_OVERWRITE_OLDEST;
+    ck_assert_ptr_null(RMP_Ctor(&xInit));
+    xInit.eOverflowPolicy = rmpOVERFLOW_POLICY_DROP_OLDEST_FRAMES;
+    ck_assert_ptr_null(RMP_Ctor(&xInit));
+
+    (void) xDstMem;
+    (void) xStats;
+#else
+    /* Самые старые байты перезаписываются: от первого сообщения остается
+     * окончание, которое отбрасывается при поиске начала сообщения */
+    xInit.eOverflowPolicy = rmpOVERFLOW_POLICY_OVERWRITE_OLDEST;
+    hOvfAPI               = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hOvfAPI);
+    ck_assert_uint_eq(60u, hOvfAPI->Put(hOvfAPI, xaPack, 3u * 20u));
+    ck_assert_uint_eq(20u, hOvfAPI->Put(hOvfAPI, &xaPack[3], 20u));
+    ck_assert_uint_eq(63u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+    for (size_t i = 1u; i < 4u; ++i) {
+        ck_assert_uint_eq(
+            20u,
+            hOvfAPI->Processing(hOvfAPI, &xDstMem, sizeof(xDstMem)));
+        ck_assert_mem_eq(&xaPack[i], &xDstMem, sizeof(xDstMem));
+    }
+
+    /* Полученное AcquireFrame() сообщение не перезаписывается */
+    hOvfAPI->Put(hOvfAPI, xaPack, 3u * 20u);
+    ck_assert_ptr_nonnull(hOvfAPI->AcquireFrame(hOvfAPI));
+    ck_assert_uint_eq(3u, hOvfAPI->Put(hOvfAPI, &xaPack[3], 20u));
+    hOvfAPI->ReleaseFrame(hOvfAPI);
+
+    #if (rmpSTATS_ENABLE == 1)
+    ck_assert(RMP_GetStatsAndReset(hOvfAPI, &xStats));
+    ck_assert_uint_eq(17u, xStats.uDiscardedBytesNumb);
+    ck_assert_uint_eq(17u, xStats.uRejectedBytesNumb);
+    ck_assert_uint_eq(0u, xStats.uDroppedFramesNumb);
+    #endif
+    ck_assert_uint_eq(true, RMP_Dtor(hOvfAPI));
+
+    /* Сообщения удаляются целиком */
+    xInit.eOverflowPolicy = rmpOVERFLOW_POLICY_DROP_OLDEST_FRAMES;
+    hOvfAPI               = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hOvfAPI);
+    ck_assert_uint_eq(60u, hOvfAPI->Put(hOvfAPI, xaPack, 3u * 20u));
+    ck_assert_uint_eq(20u, hOvfAPI->Put(hOvfAPI, &xaPack[3], 20u));
+    ck_assert_uint_eq(60u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+    for (size_t i = 1u; i < 4u; ++i) {
+        ck_assert_uint_eq(
+            20u,
+            hOvfAPI->Processing(hOvfAPI, &xDstMem, sizeof(xDstMem)));
+        ck_assert_mem_eq(&xaPack[i], &xDstMem, sizeof(xDstMem));
+    }
+
+    /* Начало сообщения уже считано конечным автоматом, при удалении
+     * сообщения поиск начинается заново */
+    hOvfAPI->Put(hOvfAPI, &xaPack[4], 10u);
+    ck_assert_uint_eq(
+        0u,
+        hOvfAPI->Processing(hOvfAPI, &xDstMem, sizeof(xDstMem)));
+    ck_assert_uint_eq(
+        rmpSTATE_WAIT_AND_COPY_MESSAGE,
+        RMP_GetState(hOvfAPI));
+
+    ck_assert_uint_eq(60u, hOvfAPI->Put(hOvfAPI, &xaPack[5], 3u * 20u));
+    ck_assert_uint_eq(rmpSTATE_FIND_FIRST_BYTE, RMP_GetState(hOvfAPI));
+
+    for (size_t i = 5u; i < 8u; ++i) {
+        ck_assert_uint_eq(
+            20u,
+            hOvfAPI->Processing(hOvfAPI, &xDstMem, sizeof(xDstMem)));
+        ck_assert_mem_eq(&xaPack[i], &xDstMem, sizeof(xDstMem));
+    }
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+    #if (rmpSTATS_ENABLE == 1)
+    ck_assert(RMP_GetStatsAndReset(hOvfAPI, &xStats));
+    ck_assert_uint_eq(20u + 8u, xStats.uDiscardedBytesNumb);
+    ck_assert_uint_eq(2u, xStats.uDroppedFramesNumb);
+    ck_assert_uint_eq(0u, xStats.uRejectedBytesNumb);
+    ck_assert_uint_eq(6u, xStats.uDeliveredFramesNumb);
+    #else
+    (void) xStats;
+    #endif
+    ck_assert_uint_eq(true, RMP_Dtor(hOvfAPI));
+#endif
+}
+
+typedef struct
+{
+    size_t         uFramesNumb;
+    size_t         uLastFrameSize;
+    const uint8_t *pLastFrame;
+    uint8_t        uaLastFrame[rmpONE_MESSAGE_SIZE_IN_BYTES];
+} test_dispatch_ctx_t;
+
+static void
+prvTestFrameHandler(void *pvCtx, const void *pvFrame, size_t uFrameSizeInBytes)
+{
+    test_dispatch_ctx_t *pxCtx = (test_dispatch_ctx_t *) pvCtx;
+
+    pxCtx->uFramesNumb++;
+    pxCtx->uLastFrameSize = uFrameSizeInBytes;
+    pxCtx->pLastFrame     = (const uint8_t *) pvFrame;
+    memcpy(pxCtx->uaLastFrame, pvFrame, sizeof(pxCtx->uaLastFrame));
+}
+
+START_TEST(DispatchByFrameType)
+{
+    static uint8_t              ucRbMemAlloc[128];
+    static rmp_obj_t            xDataMemAlloc;
+    static rmp_dispatch_entry_t xaDispatchTable[rmpDISPATCH_TYPES_NUMB];
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+
+    /* Без таблицы обработчиков Dispatch() недоступен */
+    rmp_api_handle_t hDispAPI  = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hDispAPI);
+    ck_assert(!RMP_SetFrameHandler(hDispAPI, 0x05, prvTestFrameHandler, NULL));
+    ck_assert_uint_eq(0u, hDispAPI->Dispatch(hDispAPI, 0u));
+
+    /* Байт типа за пределами сообщения */
+    xInit.pxDispatchTable     = xaDispatchTable;
+    xInit.uDispatchTypeOffset = rmpONE_MESSAGE_SIZE_IN_BYTES;
+    ck_assert_ptr_null(RMP_Ctor(&xInit));
+
+    xInit.uDispatchTypeOffset = offsetof(rmp_package_generic_t, xPLoad);
+    hDispAPI                  = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hDispAPI);
+
+    test_dispatch_ctx_t xJoyCtx   = {0};
+    test_dispatch_ctx_t xOtherCtx = {0};
+    ck_assert(
+        RMP_SetFrameHandler(hDispAPI, 0x05, prvTestFrameHandler, &xJoyCtx));
+    ck_assert(
+        RMP_SetFrameHandler(hDispAPI, 0x07, prvTestFrameHandler, &xOtherCtx));
+
+    /* Сообщения типов 0x05, 0x09 (без обработчика) и 0x07 */
+    const uint8_t uaTypes[] = {0x05, 0x09, 0x07};
+    uint8_t       uaStream[3u * rmpONE_MESSAGE_SIZE_IN_BYTES];
+    for (size_t i = 0u; i < 3u; ++i) {
+        rmp_package_generic_t xPack = {0};
+        xPack.xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+        xPack.xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+        xPack.xPLoad.uDummy[0]      = uaTypes[i];
+        xPack.xPLoad.uDummy[8]      = (uint8_t) i;
+        RPM_WriteCrcInMessageTail((void *) &xPack);
+
+        memcpy(
+            &uaStream[i * rmpONE_MESSAGE_SIZE_IN_BYTES],
+            &xPack,
+            sizeof(xPack));
+    }
+
+    /* Сообщение передается обработчику без копирования */
+    hDispAPI->Put(hDispAPI, uaStream, sizeof(uaStream));
+    ck_assert_uint_eq(2u, hDispAPI->Dispatch(hDispAPI, 0u));
+    ck_assert_uint_eq(rmpSTOP_REASON_NO_DATA, RMP_GetStopReason(hDispAPI));
+
+    ck_assert_uint_eq(1u, xJoyCtx.uFramesNumb);
+    ck_assert_uint_eq(rmpONE_MESSAGE_SIZE_IN_BYTES, xJoyCtx.uLastFrameSize);
+    ck_assert_ptr_eq(ucRbMemAlloc, xJoyCtx.pLastFrame);
+    ck_assert_mem_eq(
+        uaStream,
+        xJoyCtx.uaLastFrame,
+        rmpONE_MESSAGE_SIZE_IN_BYTES);
+
+    ck_assert_uint_eq(1u, xOtherCtx.uFramesNumb);
+    ck_assert_mem_eq(
+        &uaStream[2u * rmpONE_MESSAGE_SIZE_IN_BYTES],
+        xOtherCtx.uaLastFrame,
+        rmpONE_MESSAGE_SIZE_IN_BYTES);
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+    /* Ограничение количества сообщений за вызов */
+    hDispAPI->Put(hDispAPI, uaStream, sizeof(uaStream));
+    ck_assert_uint_eq(1u, hDispAPI->Dispatch(hDispAPI, 1u));
+    ck_assert_uint_eq(
+        rmpSTOP_REASON_FRAMES_BUDGET,
+        RMP_GetStopReason(hDispAPI));
+    ck_assert_uint_eq(1u, hDispAPI->Dispatch(hDispAPI, 1u));
+    ck_assert_uint_eq(2u, xJoyCtx.uFramesNumb);
+    ck_assert_uint_eq(2u, xOtherCtx.uFramesNumb);
+
+    /* Отмена регистрации */
+    ck_assert(RMP_SetFrameHandler(hDispAPI, 0x07, NULL, NULL));
+    hDispAPI->Put(hDispAPI, uaStream, sizeof(uaStream));
+    ck_assert_uint_eq(1u, hDispAPI->Dispatch(hDispAPI, 0u));
+    ck_assert_uint_eq(2u, xOtherCtx.uFramesNumb);
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+    ck_assert_uint_eq(true, RMP_Dtor(hDispAPI));
+
+    /* Сообщения без обработчика отбрасываются до проверки контрольной суммы,
+     * поэтому искаженное сообщение типа 0x09 не учитывается как ошибка
+     * контрольной суммы */
+    xInit.bIsDropUnregisteredTypes = true;
+    hDispAPI                       = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hDispAPI);
+    ck_assert(
+        RMP_SetFrameHandler(hDispAPI, 0x05, prvTestFrameHandler, &xJoyCtx));
+
+    uaStream[rmpONE_MESSAGE_SIZE_IN_BYTES + 10u] ^= 0xFF;
+    hDispAPI->Put(hDispAPI, uaStream, sizeof(uaStream));
+
+    const uint8_t *pFrame = hDispAPI->AcquireFrame(hDispAPI);
+    ck_assert_ptr_nonnull(pFrame);
+    ck_assert_uint_eq(0x05, pFrame[2]);
+    hDispAPI->ReleaseFrame(hDispAPI);
+    ck_assert_ptr_null(hDispAPI->AcquireFrame(hDispAPI));
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+#if (rmpSTATS_ENABLE == 1)
+    rmp_stats_t xStats;
+    ck_assert(RMP_GetStatsAndReset(hDispAPI, &xStats));
+    ck_assert_uint_eq(2u, xStats.uUnhandledFramesNumb);
+    ck_assert_uint_eq(0u, xStats.uCrcErrorsNumb);
+    ck_assert_uint_eq(1u, xStats.uDeliveredFramesNumb);
+#endif
+
+    /* Байты начала искаженного сообщения типа 0x09 считаны Processing():
+     * сообщение отбрасывается так же, как при поиске в буфере */
+    const uint8_t        *pUnhandled = &uaStream[rmpONE_MESSAGE_SIZE_IN_BYTES];
+    rmp_package_generic_t xDstMem;
+    hDispAPI->Put(hDispAPI, (void *) pUnhandled, 10u);
+    ck_assert_uint_eq(
+        0u,
+        hDispAPI->Processing(hDispAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert_uint_eq(
+        rmpSTATE_WAIT_AND_COPY_MESSAGE,
+        RMP_GetState(hDispAPI));
+    hDispAPI->Put(
+        hDispAPI,
+        (void *) &pUnhandled[10],
+        rmpONE_MESSAGE_SIZE_IN_BYTES - 10u);
+    ck_assert_ptr_null(hDispAPI->AcquireFrame(hDispAPI));
+    ck_assert_uint_eq(rmpSTATE_FIND_FIRST_BYTE, RMP_GetState(hDispAPI));
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+#if (rmpSTATS_ENABLE == 1)
+    ck_assert(RMP_GetStatsAndReset(hDispAPI, &xStats));
+    ck_assert_uint_eq(1u, xStats.uUnhandledFramesNumb);
+    ck_assert_uint_eq(0u, xStats.uCrcErrorsNumb);
+    ck_assert_uint_eq(0u, xStats.uDeliveredFramesNumb);
+#endif
+
+    ck_assert_uint_eq(true, RMP_Dtor(hDispAPI));
+
+    /* Dispatch(): достоверное сообщение без обработчика, байты начала
+     * которого считаны Processing(), не учитывается как полученное */
+    uaStream[rmpONE_MESSAGE_SIZE_IN_BYTES + 10u] ^= 0xFF;
+    xInit.bIsDropUnregisteredTypes = false;
+    hDispAPI                       = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hDispAPI);
+    ck_assert(
+        RMP_SetFrameHandler(hDispAPI, 0x05, prvTestFrameHandler, &xJoyCtx));
+
+    hDispAPI->Put(hDispAPI, (void *) pUnhandled, 10u);
+    ck_assert_uint_eq(
+        0u,
+        hDispAPI->Processing(hDispAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    hDispAPI->Put(
+        hDispAPI,
+        (void *) &pUnhandled[10],
+        rmpONE_MESSAGE_SIZE_IN_BYTES - 10u);
+    ck_assert_uint_eq(0u, hDispAPI->Dispatch(hDispAPI, 0u));
+    ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+
+#if (rmpSTATS_ENABLE == 1)
+    ck_assert(RMP_GetStatsAndReset(hDispAPI, &xStats));
+    ck_assert_uint_eq(1u, xStats.uUnhandledFramesNumb);
+    ck_assert_uint_eq(0u, xStats.uDeliveredFramesNumb);
+#endif
+
+    ck_assert_uint_eq(true, RMP_Dtor(hDispAPI));
+}
+
+START_TEST(FastPathMatchesStateMachine)
+{
+    static uint8_t   ucRbMemAlloc[2][testPAIR_RING_SIZE];
+    static rmp_obj_t xDataMemAlloc[2];
+    rmp_api_handle_t haAPI[2];
+
+    for (size_t uMode = 0u; uMode < 4u; ++uMode) {
+        /* Объект 0 - объединенная обработка, объект 1 - конечный автомат */
+        for (size_t i = 0u; i < 2u; ++i) {
+            rmp_init_t xInit;
+            RMP_StructInit(&xInit);
+            xInit.pMemAlloc            = (void *) ucRbMemAlloc[i];
+            xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc[i]);
+            xInit.hData                = &xDataMemAlloc[i];
+            xInit.bIsResyncOnCrcError  = ((uMode & 1u) != 0u);
+            xInit.uReadBytesThreshold  = ((uMode & 2u) != 0u) ? 7u : 0u;
+            xInit.bIsFastPathEnabled   = (i == 0u);
+
+            haAPI[i]                   = RMP_Ctor(&xInit);
+            ck_assert_ptr_nonnull(haAPI[i]);
+        }
+
+        rmp_channel_sim_init_t xSimInit;
+        rmp_channel_sim_t      xSim;
+        RMP_ChannelSimStructInit(&xSimInit);
+        xSimInit.uSeed              = 0x5EED0000u + (uint32_t) uMode;
+        xSimInit.uGapMaxSizeInBytes = 8u;
+        xSimInit.dBitErrorRate      = 2e-3;
+        xSimInit.uChunkSizeInBytes  = 24u;
+        xSimInit.dRateJitter        = 1.0;
+        ck_assert(RMP_ChannelSimInit(&xSim, &xSimInit));
+
+        size_t uFramesNumb = 0u;
+
+        for (size_t uIter = 0u; uIter < 4000u; ++uIter) {
+            uint8_t      uaChunk[64];
+            const size_t uChunkLen = RMP_ChannelSimGenerate(
+                &xSim,
+                uaChunk,
+                RMP_ChannelSimNextChunkSize(&xSim) % sizeof(uaChunk));
+
+            for (size_t i = 0u; i < 2u; ++i) {
+                haAPI[i]->Put(haAPI[i], uaChunk, uChunkLen);
+            }
+
+            /* Несколько вызовов на блок, чтобы буфер не переполнялся */
+            for (size_t uCall = 0u; uCall < 4u; ++uCall) {
+                rmp_package_generic_t xaDst[2];
+                size_t                uaSize[2];
+
+                for (size_t i = 0u; i < 2u; ++i) {
+                    uaSize[i] = haAPI[i]->Processing(
+                        haAPI[i],
+                        (void *) &xaDst[i],
+                        sizeof(xaDst[i]));
+                }
+
+                ck_assert_uint_eq(uaSize[0], uaSize[1]);
+                ck_assert_uint_eq(
+                    RMP_GetState(haAPI[0]),
+                    RMP_GetState(haAPI[1]));
+                ck_assert_uint_eq(
+                    RMP_GetStopReason(haAPI[0]),
+                    RMP_GetStopReason(haAPI[1]));
+                ck_assert_uint_eq(
+                    RMP_RingGetFull(&xDataMemAlloc[0].xRing),
+                    RMP_RingGetFull(&xDataMemAlloc[1].xRing));
+
+                if (uaSize[0] != 0u) {
+                    ck_assert_mem_eq(&xaDst[0], &xaDst[1], uaSize[0]);
+                    uFramesNumb++;
+                }
+            }
+        }
+
+        ck_assert_uint_gt(uFramesNumb, 100u);
+
+#if (rmpSTATS_ENABLE == 1)
+        rmp_stats_t xaStats[2];
+        for (size_t i = 0u; i < 2u; ++i) {
+            ck_assert(RMP_GetStatsAndReset(haAPI[i], &xaStats[i]));
+        }
+        ck_assert_mem_eq(&xaStats[0], &xaStats[1], sizeof(rmp_stats_t));
+#endif
+
+        for (size_t i = 0u; i < 2u; ++i) {
+            RMP_Dtor(haAPI[i]);
+        }
+    }
+}
+
+START_TEST(StateEngineSwitchMatchesTable)
+{
+    /* Форматы: по умолчанию, заданный во время выполнения и переменной
+     * длины */
+    const rmp_frame_desc_t xaDesc[3] = {
+        rmpFRAME_DESC_DEFAULT,
+        {
+            .uSyncFirstByte          = 0x7E,
+            .uSyncSecondByte         = 0x81,
+            .uFrameSizeInBytes       = 12u,
+            .uCrcOffset              = 2u,
+            .uCrcCoverageOffset      = 4u,
+            .uCrcCoverageSizeInBytes = 8u,
+        },
+        {
+            .uSyncFirstByte         = rmpSTART_FRAME_FIRST_BYTE,
+            .uSyncSecondByte        = rmpSTART_FRAME_SECOND_BYTE,
+            .uFrameSizeInBytes      = 5u + 32u,
+            .uCrcCoverageOffset     = 2u,
+            .bIsLengthPrefixed      = true,
+            .uMinPayloadSizeInBytes = 1u,
+        },
+    };
+
+    static uint8_t   ucRbMemAlloc[2][testPAIR_RING_SIZE];
+    static rmp_obj_t xDataMemAlloc[2];
+    rmp_api_handle_t haAPI[2];
+
+    srand(21);
+
+    for (size_t uMode = 0u; uMode < 3u * 4u; ++uMode) {
+        const rmp_frame_desc_t *pxDesc = &xaDesc[uMode / 4u];
+
+        /* Объект 0 - таблица функций состояний, объект 1 - switch */
+        for (size_t i = 0u; i < 2u; ++i) {
+            rmp_init_t xInit;
+            RMP_StructInit(&xInit);
+            xInit.pMemAlloc            = (void *) ucRbMemAlloc[i];
+            xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc[i]);
+            xInit.hData                = &xDataMemAlloc[i];
+            xInit.xFrameDesc           = *pxDesc;
+            xInit.bIsResyncOnCrcError  = ((uMode & 1u) != 0u);
+            xInit.bIsFastPathEnabled   = ((uMode & 2u) != 0u);
+
+            haAPI[i]                   = RMP_Ctor(&xInit);
+            ck_assert_ptr_nonnull(haAPI[i]);
+        }
+
+        size_t uFramesNumb = 0u;
+
+        for (size_t uIter = 0u; uIter < 3000u; ++uIter) {
+            /* Достоверное сообщение, которому предшествуют случайные байты
+             * с частыми байтами начала сообщения и байтами длины */
+            uint8_t uaChunk[80];
+            size_t  uChunkLen = (size_t) rand() % 8u;
+
+            for (size_t j = 0u; j < uChunkLen; ++j) {
+                const uint8_t uaNoise[4] = {
+                    pxDesc->uSyncFirstByte,
+                    pxDesc->uSyncSecondByte,
+                    (uint8_t) (rand() % 40),
+                    (uint8_t) rand()};
+                uaChunk[j] = uaNoise[rand() % 4];
+            }
+
+            rmp_frame_desc_t xFrameDesc = *pxDesc;
+            uint8_t         *pFrame     = &uaChunk[uChunkLen];
+
+            if (pxDesc->bIsLengthPrefixed) {
+                pFrame[2] = (uint8_t) (1u + (size_t) rand() % 32u);
+                ck_assert(RMP_GetLengthPrefixedFrameDesc(
+                    pxDesc,
+                    pFrame[2],
+                    &xFrameDesc));
+            }
+
+            pFrame[0] = pxDesc->uSyncFirstByte;
+            pFrame[1] = pxDesc->uSyncSecondByte;
+            for (size_t j = pxDesc->bIsLengthPrefixed ? 3u : 2u;
+                 j < xFrameDesc.uFrameSizeInBytes;
+                 ++j) {
+                pFrame[j] = (uint8_t) rand();
+            }
+            RMP_WriteFrameCrc(&xFrameDesc, pFrame);
+
+            /* Искажение и частичная запись сообщения */
+            if ((rand() % 8) == 0) {
+                pFrame[(size_t) rand() % xFrameDesc.uFrameSizeInBytes] ^=
+                    (uint8_t) (1u << (rand() % 8));
+            }
+            uChunkLen += xFrameDesc.uFrameSizeInBytes;
+            uChunkLen -= (size_t) rand() % 3u;
+
+            for (size_t i = 0u; i < 2u; ++i) {
+                haAPI[i]->Put(haAPI[i], uaChunk, uChunkLen);
+            }
+
+            /* Несколько вызовов на блок со случайным ограничением количества
+             * байт, чтобы буфер не переполнялся */
+            for (size_t uCall = 0u; uCall < 4u; ++uCall) {
+                const size_t    uBudget = ((size_t) rand() % 64u) + 1u;
+                uint8_t         uaDst[2][rmpFRAME_MAX_SIZE_IN_BYTES];
+                rmp_return_code eaCode[2];
+
+                for (size_t i = 0u; i < 2u; ++i) {
+                    xDataMemAlloc[i].uReadBytesLeft = uBudget;
+                }
+
+                eaCode[0] =
+                    RMP_RunStateTable(haAPI[0], uaDst[0], sizeof(uaDst[0]));
+                eaCode[1] =
+                    RMP_RunStateSwitch(haAPI[1], uaDst[1], sizeof(uaDst[1]));
+
+                ck_assert_uint_eq(eaCode[0], eaCode[1]);
+                ck_assert_uint_eq(
+                    RMP_GetState(haAPI[0]),
+                    RMP_GetState(haAPI[1]));
+                ck_assert_uint_eq(
+                    xDataMemAlloc[0].uReadBytesCnt,
+                    xDataMemAlloc[1].uReadBytesCnt);
+                ck_assert_uint_eq(
+                    xDataMemAlloc[0].uReadBytesLeft,
+                    xDataMemAlloc[1].uReadBytesLeft);
+                ck_assert_uint_eq(
+                    RMP_RingGetFull(&xDataMemAlloc[0].xRing),
+                    RMP_RingGetFull(&xDataMemAlloc[1].xRing));
+
+                if (eaCode[0] == rmpMESSAGE_COPIED) {
+                    ck_assert_uint_eq(
+                        xDataMemAlloc[0].uFrameSizeInBytes,
+                        xDataMemAlloc[1].uFrameSizeInBytes);
+                    ck_assert_mem_eq(
+                        uaDst[0],
+                        uaDst[1],
+                        xDataMemAlloc[0].uFrameSizeInBytes);
+                    uFramesNumb++;
+                }
+            }
+        }
+
+        ck_assert_uint_gt(uFramesNumb, 300u);
+
+#if (rmpSTATS_ENABLE == 1)
+        rmp_stats_t xaStats[2];
+        for (size_t i = 0u; i < 2u; ++i) {
+            ck_assert(RMP_GetStatsAndReset(haAPI[i], &xaStats[i]));
+        }
+        ck_assert_mem_eq(&xaStats[0], &xaStats[1], sizeof(rmp_stats_t));
+#endif
+
+        for (size_t i = 0u; i < 2u; ++i) {
+            RMP_Dtor(haAPI[i]);
+        }
+    }
+}
+
+START_TEST(ChannelSimulator)
+{
+    rmp_channel_sim_init_t xSimInit;
+    rmp_channel_sim_t      xSim;
+    rmp_channel_sim_t      xSimCopy;
+
+    RMP_ChannelSimStructInit(&xSimInit);
+    xSimInit.uSeed = 0u;
+    ck_assert(!RMP_ChannelSimInit(&xSim, &xSimInit));
+
+    /* Одинаковое начальное значение формирует одинаковый поток */
+    xSimInit.uSeed                 = 0xA5A5A5A5u;
+    xSimInit.uGapMaxSizeInBytes    = 16u;
+    xSimInit.dBitErrorRate         = 1e-3;
+    xSimInit.dByteDropRate         = 1e-3;
+    xSimInit.dOutageRate           = 0.01;
+    xSimInit.uOutageMaxSizeInBytes = 40u;
+    xSimInit.dRateJitter           = 1.0;
+    ck_assert(RMP_ChannelSimInit(&xSim, &xSimInit));
+    ck_assert(RMP_ChannelSimInit(&xSimCopy, &xSimInit));
+
+    static uint8_t uaStream[2][4096];
+    ck_assert_uint_eq(
+        sizeof(uaStream[0]),
+        RMP_ChannelSimGenerate(&xSim, uaStream[0], sizeof(uaStream[0])));
+    ck_assert_uint_eq(
+        sizeof(uaStream[1]),
+        RMP_ChannelSimGenerate(&xSimCopy, uaStream[1], sizeof(uaStream[1])));
+    ck_assert_mem_eq(uaStream[0], uaStream[1], sizeof(uaStream[0]));
+    /*------------------------------------------------------------------------*/
+
+    static uint8_t   ucRbMemAlloc[256];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+
+    rmp_api_handle_t hSimAPI   = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hSimAPI);
+
+    /* Канал без искажений: промежутки между сообщениями и неравномерная
+     * скорость не приводят к потере сообщений */
+    rmp_channel_sim_result_t xResult;
+
+    RMP_ChannelSimStructInit(&xSimInit);
+    xSimInit.uGapMaxSizeInBytes = 16u;
+    xSimInit.dRateJitter        = 1.0;
+    ck_assert(RMP_ChannelSimInit(&xSim, &xSimInit));
+    ck_assert(RMP_ChannelSimRun(&xSim, hSimAPI, 2000u, &xResult));
+    ck_assert_uint_eq(2000u, xResult.uSentFramesNumb);
+    ck_assert_uint_eq(2000u, xResult.uRecoveredFramesNumb);
+    ck_assert_uint_eq(0u, xResult.uFalseFramesNumb);
+    ck_assert_uint_eq(xSim.uStreamBytesNumb, xResult.uStreamBytesNumb);
+
+    /* Канал с искажениями */
+    xSimInit.dBitErrorRate         = 1e-4;
+    xSimInit.dByteDropRate         = 1e-4;
+    xSimInit.dOutageRate           = 0.01;
+    xSimInit.uOutageMaxSizeInBytes = 40u;
+    ck_assert(RMP_ChannelSimInit(&xSim, &xSimInit));
+    hSimAPI->Reset(hSimAPI);
+    ck_assert(RMP_ChannelSimRun(&xSim, hSimAPI, 2000u, &xResult));
+    ck_assert_uint_eq(2000u, xResult.uSentFramesNumb);
+    ck_assert_uint_lt(xResult.uRecoveredFramesNumb, 2000u);
+    ck_assert_uint_gt(xResult.uRecoveredFramesNumb, 1800u);
+
+    ck_assert_uint_eq(true, RMP_Dtor(hSimAPI));
+}
+
+static uint64_t uTestNow;
+
+static uint64_t
+prvTestGetTimestamp(void)
+{
+    return (uTestNow);
+}
+
+START_TEST(LatencyHistogram)
+{
+    static uint8_t   ucRbMemAlloc[128];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc             = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes  = sizeof(ucRbMemAlloc);
+    xInit.hData                 = &xDataMemAlloc;
+    xInit.pfnGetTimestamp       = prvTestGetTimestamp;
+
+    rmp_api_handle_t hLatAPI    = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hLatAPI);
+
+    rmp_package_generic_t xSrcMem = {0};
+    rmp_package_generic_t xDstMem = {0};
+    xSrcMem.xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+    xSrcMem.xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+    RPM_WriteCrcInMessageTail((void *) &xSrcMem);
+
+    const uint8_t *pSrc           = (const uint8_t *) &xSrcMem;
+    uint64_t       uValue         = 0u;
+
+#if (rmpLATENCY_ENABLE == 1)
+    ck_assert(!RMP_GetLatencyPercentile(
+        hLatAPI,
+        rmpLATENCY_FIRST_BYTE,
+        50.0,
+        &uValue));
+
+    /* Сообщение записано двумя блоками, перед ним байты, сброшенные
+     * Reset() */
+    uint8_t uaNoise[5] = {0};
+    hLatAPI->Put(hLatAPI, uaNoise, sizeof(uaNoise));
+    hLatAPI->Reset(hLatAPI);
+
+    uTestNow = 100u;
+    hLatAPI->Put(hLatAPI, (void *) pSrc, 7u);
+    uTestNow = 150u;
+    hLatAPI->Put(hLatAPI, (void *) &pSrc[7], sizeof(xSrcMem) - 7u);
+    uTestNow = 400u;
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hLatAPI->Processing(hLatAPI, (void *) &xDstMem, sizeof(xDstMem)));
+
+    ck_assert(RMP_GetLatencyPercentile(
+        hLatAPI,
+        rmpLATENCY_FIRST_BYTE,
+        50.0,
+        &uValue));
+    ck_assert_uint_eq(300u, uValue);
+    ck_assert(
+        RMP_GetLatencyPercentile(hLatAPI, rmpLATENCY_LAST_BYTE, 50.0, &uValue));
+    ck_assert_uint_eq(250u, uValue);
+    /*------------------------------------------------------------------------*/
+
+    /* Задержки 1..100 через Processing() и AcquireFrame() */
+    ck_assert(RMP_ResetLatency(hLatAPI));
+    ck_assert(
+        !RMP_GetLatencyPercentile(hLatAPI, rmpLATENCY_LAST_BYTE, 0.0, &uValue));
+
+    for (uint64_t i = 1u; i <= 100u; ++i) {
+        uTestNow = 1000u * i;
+        hLatAPI->Put(hLatAPI, (void *) pSrc, sizeof(xSrcMem));
+        uTestNow += i;
+
+        if ((i % 2u) == 0u) {
+            ck_assert_ptr_nonnull(hLatAPI->AcquireFrame(hLatAPI));
+            hLatAPI->ReleaseFrame(hLatAPI);
+        } else {
+            ck_assert_uint_eq(
+                sizeof(xSrcMem),
+                hLatAPI->Processing(
+                    hLatAPI,
+                    (void *) &xDstMem,
+                    sizeof(xDstMem)));
+        }
+    }
+
+    for (size_t j = 0u; j < rmpLATENCY_MAX_NUMB; ++j) {
+        ck_assert(RMP_GetLatencyPercentile(
+            hLatAPI,
+            (rmp_latency_e) j,
+            0.0,
+            &uValue));
+        ck_assert_uint_eq(1u, uValue);
+        ck_assert(RMP_GetLatencyPercentile(
+            hLatAPI,
+            (rmp_latency_e) j,
+            100.0,
+            &uValue));
+        ck_assert_uint_eq(100u, uValue);
+
+        /* Погрешность не превышает интервала гистограммы */
+        ck_assert(RMP_GetLatencyPercentile(
+            hLatAPI,
+            (rmp_latency_e) j,
+            50.0,
+            &uValue));
+        ck_assert_uint_ge(uValue, 50u);
+        ck_assert_uint_le(uValue, 50u + (50u >> 2u));
+        ck_assert(RMP_GetLatencyPercentile(
+            hLatAPI,
+            (rmp_latency_e) j,
+            99.0,
+            &uValue));
+        ck_assert_uint_ge(uValue, 99u);
+        ck_assert_uint_le(uValue, 100u);
+    }
+#else
+    /* Измерение задержки не компилируется */
+    hLatAPI->Put(hLatAPI, (void *) pSrc, sizeof(xSrcMem));
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hLatAPI->Processing(hLatAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert(!RMP_GetLatencyPercentile(
+        hLatAPI,
+        rmpLATENCY_FIRST_BYTE,
+        50.0,
+        &uValue));
+    ck_assert(!RMP_ResetLatency(hLatAPI));
+#endif
+
+    RMP_Dtor(hLatAPI);
+}
+
+START_TEST(RxTimestamp)
+{
+    static uint8_t   ucRbMemAlloc[128];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+    xInit.pfnGetTimestamp      = prvTestGetTimestamp;
+    xInit.uByteDuration        = 10u;
+
+    rmp_api_handle_t hTsAPI    = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hTsAPI);
+
+    rmp_package_generic_t xSrcMem = {0};
+    rmp_package_generic_t xDstMem = {0};
+    xSrcMem.xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+    xSrcMem.xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+    RPM_WriteCrcInMessageTail((void *) &xSrcMem);
+
+    uint8_t uaChunk[10u + sizeof(xSrcMem)] = {0};
+    memcpy(&uaChunk[10], &xSrcMem, sizeof(xSrcMem));
+
+    rmp_frame_info_t xInfo = {0};
+    uint64_t         uRxTs = 0u;
+
+#if (rmpRX_TIMESTAMP_ENABLE == 1)
+    ck_assert(!RMP_GetFrameRxTimestamp(hTsAPI, &uRxTs));
+
+    /* Начало сообщения - 6-й байт блока из 12 байт: время записи блока
+     * минус 6 длительностей байта */
+    uTestNow = 1000u;
+    hTsAPI->Put(hTsAPI, &uaChunk[5], 12u);
+    uTestNow = 1100u;
+    hTsAPI->Put(hTsAPI, &uaChunk[17], sizeof(xSrcMem) - 7u);
+    uTestNow = 1200u;
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hTsAPI->ProcessingEx(
+            hTsAPI,
+            (void *) &xDstMem,
+            sizeof(xDstMem),
+            &xInfo));
+    ck_assert_uint_eq(sizeof(xSrcMem), xInfo.uFrameSizeInBytes);
+    ck_assert(xInfo.bIsRxTimestampValid);
+    ck_assert_uint_eq(1000u - 6u * 10u, xInfo.uRxTimestamp);
+
+    /* Байты не могли поступить раньше записи предыдущего блока */
+    uTestNow = 4800u;
+    hTsAPI->Put(hTsAPI, uaChunk, 3u);
+    uTestNow = 4900u;
+    hTsAPI->Put(hTsAPI, &uaChunk[10], sizeof(xSrcMem));
+    uTestNow = 5000u;
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hTsAPI->ProcessingEx(
+            hTsAPI,
+            (void *) &xDstMem,
+            sizeof(xDstMem),
+            &xInfo));
+    ck_assert_uint_eq(4800u, xInfo.uRxTimestamp);
+    /*------------------------------------------------------------------------*/
+
+    /* Длительность байта неизвестна: линейная интерполяция между метками */
+    ((rmp_data_handle_t) hTsAPI)->uByteDuration = 0u;
+
+    uTestNow = 6000u;
+    hTsAPI->Put(hTsAPI, uaChunk, 10u);
+    uTestNow = 7000u;
+    hTsAPI->Put(hTsAPI, uaChunk, sizeof(uaChunk));
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hTsAPI->ProcessingEx(
+            hTsAPI,
+            (void *) &xDstMem,
+            sizeof(xDstMem),
+            &xInfo));
+    ck_assert_uint_eq(
+        6000u + 1000u * 11u / sizeof(uaChunk),
+        xInfo.uRxTimestamp);
+
+    /* AcquireFrame() */
+    uTestNow = 8000u;
+    hTsAPI->Put(hTsAPI, &xSrcMem, sizeof(xSrcMem));
+    ck_assert_ptr_nonnull(hTsAPI->AcquireFrame(hTsAPI));
+    ck_assert(RMP_GetFrameRxTimestamp(hTsAPI, &uRxTs));
+    ck_assert_uint_eq(7000u + 1000u / sizeof(xSrcMem), uRxTs);
+    hTsAPI->ReleaseFrame(hTsAPI);
+#else
+    /* Время поступления не компилируется */
+    hTsAPI->Put(hTsAPI, &xSrcMem, sizeof(xSrcMem));
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hTsAPI->ProcessingEx(
+            hTsAPI,
+            (void *) &xDstMem,
+            sizeof(xDstMem),
+            &xInfo));
+    ck_assert_uint_eq(sizeof(xSrcMem), xInfo.uFrameSizeInBytes);
+    ck_assert(!xInfo.bIsRxTimestampValid);
+    ck_assert(!RMP_GetFrameRxTimestamp(hTsAPI, &uRxTs));
+#endif
+
+    RMP_Dtor(hTsAPI);
+}
+
+#if (rmpNOTIFY_ENABLE == 1)
+/**
+ * @brief Проверяет, что дескриптор пробуждения доступен для чтения.
+ */
+static bool
+prvTestIsNotifyFdReadable(int iFd)
+{
+    struct pollfd xPollFd = {.fd = iFd, .events = POLLIN};
+
+    return (poll(&xPollFd, 1u, 0) > 0);
+}
+#endif
+
+START_TEST(FrameNotify)
+{
+    static uint8_t   ucRbMemAlloc[128];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+
+    rmp_api_handle_t hNtfAPI   = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hNtfAPI);
+
+    rmp_package_generic_t xSrcMem = {0};
+    rmp_package_generic_t xDstMem = {0};
+    xSrcMem.xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+    xSrcMem.xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+    RPM_WriteCrcInMessageTail((void *) &xSrcMem);
+
+    uint8_t *pSrc = (uint8_t *) &xSrcMem;
+
+#if (rmpNOTIFY_ENABLE == 1)
+    const int iFd = RMP_GetNotifyFd(hNtfAPI);
+    ck_assert_int_ge(iFd, 0);
+
+    /* Пустой буфер: тайм-аут */
+    ck_assert(!RMP_WaitForFrame(hNtfAPI, 0u));
+
+    /* Пробуждение только после записи последнего байта сообщения */
+    ck_assert(!RMP_ArmFrameNotify(hNtfAPI));
+    hNtfAPI->Put(hNtfAPI, pSrc, sizeof(xSrcMem) - 1u);
+    ck_assert(!prvTestIsNotifyFdReadable(iFd));
+    hNtfAPI->Put(hNtfAPI, &pSrc[sizeof(xSrcMem) - 1u], 1u);
+    ck_assert(prvTestIsNotifyFdReadable(iFd));
+
+    /* Последующие байты пробуждение не повторяют */
+    ck_assert(RMP_ArmFrameNotify(hNtfAPI));
+    ck_assert(!prvTestIsNotifyFdReadable(iFd));
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hNtfAPI->Processing(hNtfAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert_mem_eq(&xSrcMem, &xDstMem, sizeof(xSrcMem));
+    /*------------------------------------------------------------------------*/
+
+    /* Часть сообщения уже считана конечным автоматом: ожидаются только
+     * недостающие байты */
+    hNtfAPI->Put(hNtfAPI, pSrc, 10u);
+    ck_assert_uint_eq(
+        0u,
+        hNtfAPI->Processing(hNtfAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert(!RMP_ArmFrameNotify(hNtfAPI));
+    hNtfAPI->Put(hNtfAPI, &pSrc[10], sizeof(xSrcMem) - 11u);
+    ck_assert(!prvTestIsNotifyFdReadable(iFd));
+    hNtfAPI->Put(hNtfAPI, &pSrc[sizeof(xSrcMem) - 1u], 1u);
+    ck_assert(prvTestIsNotifyFdReadable(iFd));
+
+    /* Пробуждение получено до ожидания */
+    ck_assert(RMP_WaitForFrame(hNtfAPI, rmpNOTIFY_WAIT_FOREVER));
+    ck_assert(!prvTestIsNotifyFdReadable(iFd));
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hNtfAPI->Processing(hNtfAPI, (void *) &xDstMem, sizeof(xDstMem)));
+    ck_assert_mem_eq(&xSrcMem, &xDstMem, sizeof(xSrcMem));
+#else
+    /* Ожидание не компилируется */
+    ck_assert_int_eq(-1, RMP_GetNotifyFd(hNtfAPI));
+    ck_assert(!RMP_ArmFrameNotify(hNtfAPI));
+    ck_assert(!RMP_WaitForFrame(hNtfAPI, 0u));
+
+    hNtfAPI->Put(hNtfAPI, pSrc, sizeof(xSrcMem));
+    ck_assert_uint_eq(
+        sizeof(xSrcMem),
+        hNtfAPI->Processing(hNtfAPI, (void *) &xDstMem, sizeof(xDstMem)));
+#endif
+
+    RMP_Dtor(hNtfAPI);
+}
+
+START_TEST(Stats)
+{
+    rmp_stats_t xStats;
+
+#if (rmpSTATS_ENABLE == 1)
+    ck_assert(RMP_GetStatsAndReset(hAPI, &xStats));
+
+    rmp_package_generic_t xDstMem = {0};
+
+    /* Ложный первый байт в конце линейного блока */
+    uint8_t uaNoise[] = {0x11, 0x22, rmpSTART_FRAME_FIRST_BYTE};
+    hAPI->Put(hAPI, uaNoise, sizeof(uaNoise));
+    hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem));
+    ck_assert_uint_eq(rmpSTATE_FIND_SECOND_BYTE, RMP_GetState(hAPI));
+
+    uint8_t uNoise = 0x33;
+    hAPI->Put(hAPI, &uNoise, sizeof(uNoise));
+    hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem));
+
+    /* Сообщение с достоверной и недостоверной контрольной суммой */
+    rmp_package_generic_t xSrcMem = {0};
+    xSrcMem.xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+    xSrcMem.xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+    RPM_WriteCrcInMessageTail((void *) &xSrcMem);
+
+    hAPI->Put(hAPI, &xSrcMem, sizeof(xSrcMem));
+    ck_assert_uint_eq(
+        rmpONE_MESSAGE_SIZE_IN_BYTES,
+        hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+
+    xSrcMem.uCrc ^= 1u;
+    hAPI->Put(hAPI, &xSrcMem, sizeof(xSrcMem));
+    ck_assert_uint_eq(
+        0u,
+        hAPI->Processing(hAPI, (void *) &xDstMem, sizeof(xDstMem)));
+
+    /* Переполнение кольцевого буфера */
+    uint8_t uaFill[200] = {0};
+    ck_assert_uint_eq(
+        RMP_RingGetSize(&hData->xRing) - 1u,
+        hAPI->Put(hAPI, uaFill, sizeof(uaFill)));
+    hAPI->Reset(hAPI);
+
+    ck_assert(RMP_GetStatsAndReset(hAPI, &xStats));
+    ck_assert_uint_eq(
+        sizeof(uaNoise) + sizeof(uNoise) + 2u * sizeof(xSrcMem)
+            + RMP_RingGetSize(&hData->xRing) - 1u,
+        xStats.uIngestedBytesNumb);
+    ck_assert_uint_eq(
+        sizeof(uaFill) - (RMP_RingGetSize(&hData->xRing) - 1u),
+        xStats.uRejectedBytesNumb);
+    ck_assert_uint_eq(4u, xStats.uSkippedBytesNumb);
+    ck_assert_uint_eq(1u, xStats.uFalseFirstByteNumb);
+    ck_assert_uint_eq(1u, xStats.uCrcErrorsNumb);
+    ck_assert_uint_eq(1u, xStats.uDeliveredFramesNumb);
+    ck_assert_uint_eq(1u, xStats.uResetsNumb);
+
+    /* Счетчики обнулены предыдущим вызовом */
+    ck_assert(RMP_GetStatsAndReset(hAPI, &xStats));
+    ck_assert_uint_eq(0u, xStats.uIngestedBytesNumb);
+    ck_assert_uint_eq(0u, xStats.uResetsNumb);
+#else
+    /* Статистика не компилируется */
+    ck_assert(!RMP_GetStatsAndReset(hAPI, &xStats));
+    ck_assert_uint_eq(0u, xStats.uDeliveredFramesNumb);
+#endif
+}
+
+#if (rmpRING_BACKEND == rmpRING_BACKEND_POW2)
+START_TEST(RingPow2IndexOverflow)
+{
+    /* Размер буфера должен быть степенью 2 */
+    static uint8_t   ucRbMemAlloc[100];
+    static rmp_obj_t xDataMemAlloc;
+
+    rmp_init_t xInit;
+    RMP_StructInit(&xInit);
+    xInit.pMemAlloc            = (void *) ucRbMemAlloc;
+    xInit.uMemAllocSizeInBytes = sizeof(ucRbMemAlloc);
+    xInit.hData                = &xDataMemAlloc;
+    ck_assert_ptr_null(RMP_Ctor(&xInit));
+
+    xInit.uMemAllocSizeInBytes = 64u;
+    rmp_api_handle_t hPow2API  = RMP_Ctor(&xInit);
+    ck_assert_ptr_nonnull(hPow2API);
+    ck_assert_uint_eq(63u, RMP_RingGetFree(&xDataMemAlloc.xRing));
+
+    /* Позиции чтения и записи переполняются во время приема сообщений */
+    atomic_store(&xDataMemAlloc.xRing.uR, SIZE_MAX - 30u);
+    atomic_store(&xDataMemAlloc.xRing.uW, SIZE_MAX - 30u);
+
+    rmp_package_generic_t xSrcMem = {0};
+    rmp_package_generic_t xDstMem = {0};
+    xSrcMem.xHead.uFirstByte      = rmpSTART_FRAME_FIRST_BYTE;
+    xSrcMem.xHead.uSecondByte     = rmpSTART_FRAME_SECOND_BYTE;
+
+    for (size_t i = 0u; i < 8u; ++i) {
+        xSrcMem.xPLoad.uDummy[0] = (uint8_t) i;
+        RPM_WriteCrcInMessageTail((void *) &xSrcMem);
+
+        ck_assert_uint_eq(
+            sizeof(xSrcMem),
+            hPow2API->Put(hPow2API, &xSrcMem, sizeof(xSrcMem)));
+        ck_assert_uint_eq(
+            sizeof(xDstMem),
+            hPow2API->Processing(hPow2API, &xDstMem, sizeof(xDstMem)));
+        ck_assert_mem_eq(&xSrcMem, &xDstMem, sizeof(xDstMem));
+        ck_assert_uint_eq(0u, RMP_RingGetFull(&xDataMemAlloc.xRing));
+    }
+
+    ck_assert_uint_lt(
+        atomic_load(&xDataMemAlloc.xRing.uW),
+        sizeof(xSrcMem) * 8u);
+    ck_assert_uint_eq(true, RMP_Dtor(hPow2API));
+}
+#endif
+
 START_TEST(Reset)
 {
     ck_assert_ptr_nonnull(hAPI);
@@ -527,6 +2506,12 @@ main(int argc, char *argv[], char *envp[])
         tcase_add_test(tc, GetCrcByReferencePack);
         tcase_add_test(tc, WriteCrcInMessageTail);
         tcase_add_test(tc, CheckCrcValidation);
+        tcase_add_test(tc, CrcEngineMatchBitwise);
+#if (rmpCRC_CLMUL_ENABLE == 1)
+        tcase_add_test(tc, CrcClmulMatchBitwise);
+#endif
+        tcase_add_test(tc, CrcValidationMulti);
+        tcase_add_test(tc, FindSyncWordMatchNaive);
 
         /*--------------------------------------------------------------------*/
 
@@ -556,7 +2541,29 @@ main(int argc, char *argv[], char *envp[])
         tcase_add_test(tc, StateFindStartFrame);
         tcase_add_test(tc, FindStartFrameAndCopyMessage);
         tcase_add_test(tc, FindStartFrameAndCopySomeMessages);
+        tcase_add_test(tc, FindStartFrameAcrossBufferWrap);
         tcase_add_test(tc, FindStartFrameAndCopyMessageInSmallDstBuff);
+        tcase_add_test(tc, AcquireFrameZeroCopy);
+        tcase_add_test(tc, AcquireFrameAfterProcessing);
+        tcase_add_test(tc, ProcessingBatch);
+        tcase_add_test(tc, ResyncOnCrcError);
+        tcase_add_test(tc, ProcessingBudget);
+        tcase_add_test(tc, WriteSpanSimulatedDMA);
+        tcase_add_test(tc, MirroredMemFrameAcrossSeam);
+        tcase_add_test(tc, CustomFrameDesc);
+        tcase_add_test(tc, LengthPrefixedFrame);
+        tcase_add_test(tc, OverflowPolicy);
+        tcase_add_test(tc, DispatchByFrameType);
+        tcase_add_test(tc, FastPathMatchesStateMachine);
+        tcase_add_test(tc, StateEngineSwitchMatchesTable);
+        tcase_add_test(tc, ChannelSimulator);
+        tcase_add_test(tc, LatencyHistogram);
+        tcase_add_test(tc, RxTimestamp);
+        tcase_add_test(tc, FrameNotify);
+        tcase_add_test(tc, Stats);
+#if (rmpRING_BACKEND == rmpRING_BACKEND_POW2)
+        tcase_add_test(tc, RingPow2IndexOverflow);
+#endif
         tcase_add_test(tc, Reset);
         tcase_add_test(tc, JoyCommand);
 